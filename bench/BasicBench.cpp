@@ -0,0 +1,323 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "BatchExecutor.h"
+#include "CompileCache.h"
+#include "CompileError.h"
+#include "Compiler.h"
+#include "Interpreter.h"
+#include "NullConsole.h"
+#include "SourceFile.h"
+#include "TextSourceStream.h"
+
+// Whole-program benchmark harness.  Each program is compiled with
+// Compiler::run, loaded into an Interpreter and executed a number of times,
+// timing each phase separately.  One extra run in DispatchMode::Counting
+// gives the number of instructions executed, from which ops/sec is derived.
+// With --cache, programs are compiled through a CompileCache in that
+// directory, so compile times after the first are cache hits.  With --jobs,
+// every program is also run the given number of iterations as one batch
+// through a BatchExecutor with that many threads, to measure throughput.
+// With tracing dispatch, the --trace-* options set the tracer's thresholds
+// (see TraceOptions), and each program's results list the traces compiled in
+// its last timed run.  Results are written to stdout as JSON:
+//
+//     zbbench [--iterations N] [--dispatch call|threaded|native|tracing] [--cache dir] [--jobs N]
+//             [--trace-hot N] [--trace-length N] [--trace-attempts N] file.bas...
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct Summary
+    {
+        double min;
+        double median;
+        double mean;
+    };
+
+    Summary Summarize(std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+
+        Summary summary;
+        summary.min = samples.front();
+        summary.median = samples[samples.size() / 2];
+        summary.mean = 0;
+        for (double sample : samples)
+            summary.mean += sample;
+        summary.mean /= samples.size();
+        return summary;
+    }
+
+    double ElapsedMs(Clock::time_point start, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    std::string GetName(const std::string& filename)
+    {
+        size_t start = filename.find_last_of("/\\");
+        start = start == std::string::npos ? 0 : start + 1;
+        size_t end = filename.rfind('.');
+        if (end == std::string::npos || end < start)
+            end = filename.length();
+        return filename.substr(start, end - start);
+    }
+
+    std::string Quote(const std::string& text)
+    {
+        std::string quoted = "\"";
+        for (char ch : text) {
+            if (ch == '"' || ch == '\\')
+                quoted += '\\';
+            if ((unsigned char)ch >= 0x20)
+                quoted += ch;
+        }
+        return quoted + "\"";
+    }
+
+    void PrintSummary(const char* name, const Summary& summary)
+    {
+        printf("      \"%s\": { \"min\": %.4f, \"median\": %.4f, \"mean\": %.4f },\n", name, summary.min, summary.median, summary.mean);
+    }
+
+    void PrintTraces(const std::vector<TraceStats>& traces, int abortCount)
+    {
+        printf("      \"trace_aborts\": %d,\n", abortCount);
+        printf("      \"traces\": [");
+        for (size_t ix = 0; ix < traces.size(); ++ix) {
+            auto& trace = traces[ix];
+            printf("%s\n        { \"anchor\": %d, \"length\": %d, \"code_bytes\": %llu, \"entries\": %llu, \"iterations\": %llu }",
+                ix ? "," : "", trace.anchor, trace.length, (unsigned long long)trace.codeSize,
+                (unsigned long long)trace.entries, (unsigned long long)trace.iterations);
+        }
+        printf("%s],\n", traces.empty() ? "" : "\n      ");
+    }
+
+    bool ParseDispatchMode(const char* text, DispatchMode& mode)
+    {
+        static const struct
+        {
+            const char* name;
+            DispatchMode mode;
+        } modes[] = {
+            { "call", DispatchMode::Call },
+            { "threaded", DispatchMode::Threaded },
+            { "native", DispatchMode::Native },
+            { "tracing", DispatchMode::Tracing }
+        };
+
+        for (auto& entry : modes) {
+            if (strcmp(text, entry.name) == 0) {
+                mode = entry.mode;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // returns false if the program didn't compile
+    bool RunBenchmark(const std::string& filename, int iterations, DispatchMode dispatchMode, const TraceOptions& traceOptions, CompileCache* cache, bool first)
+    {
+        std::string code;
+        if (!readSourceFile(filename, code)) {
+            fprintf(stderr, "Failed to open file: %s\n", filename.c_str());
+            return false;
+        }
+
+        std::vector<double> compileTimes;
+        std::vector<double> loadTimes;
+        std::vector<double> runTimes;
+        uint64_t instructions = 0;
+        std::vector<TraceStats> traces;
+        int traceAborts = 0;
+
+        Compiler compiler;
+        compiler.setCache(cache);
+        NullConsole console;
+        try {
+            for (int ix = 0; ix < iterations; ++ix) {
+                auto start = Clock::now();
+                TextSourceStream stream(code.data(), (int)code.length());
+                auto program = compiler.run(stream);
+                auto compiled = Clock::now();
+                Interpreter interpreter(console, program, dispatchMode);
+                interpreter.setTraceOptions(traceOptions);
+                auto loaded = Clock::now();
+                interpreter.run();
+                auto finished = Clock::now();
+                traces = interpreter.getTracer().getStats();
+                traceAborts = interpreter.getTracer().getAbortCount();
+
+                compileTimes.push_back(ElapsedMs(start, compiled));
+                loadTimes.push_back(ElapsedMs(compiled, loaded));
+                runTimes.push_back(ElapsedMs(loaded, finished));
+            }
+
+            TextSourceStream stream(code.data(), (int)code.length());
+            auto program = compiler.run(stream);
+            Interpreter interpreter(console, program, DispatchMode::Counting);
+            interpreter.run();
+            instructions = interpreter.getExecutedCount();
+        }
+        catch (const CompileError& error) {
+            fprintf(stderr, "%s\n", formatCompileError(filename, error).c_str());
+            return false;
+        }
+
+        Summary run = Summarize(runTimes);
+
+        printf("%s    {\n", first ? "" : ",\n");
+        printf("      \"name\": %s,\n", Quote(GetName(filename)).c_str());
+        printf("      \"file\": %s,\n", Quote(filename).c_str());
+        PrintSummary("compile_ms", Summarize(compileTimes));
+        PrintSummary("load_ms", Summarize(loadTimes));
+        PrintSummary("run_ms", run);
+        if (dispatchMode == DispatchMode::Tracing)
+            PrintTraces(traces, traceAborts);
+        printf("      \"instructions\": %llu,\n", (unsigned long long)instructions);
+        printf("      \"ops_per_sec\": %.0f\n", run.median > 0 ? instructions / (run.median / 1000.0) : 0.0);
+        printf("    }");
+        return true;
+    }
+
+    // returns false if any program failed
+    bool RunBatch(const std::vector<std::string>& files, int iterations, DispatchMode dispatchMode, int threadCount)
+    {
+        std::vector<BatchJob> jobs;
+        for (int ix = 0; ix < iterations; ++ix) {
+            for (auto& file : files) {
+                jobs.push_back(BatchJob());
+                jobs.back().filename = file;
+            }
+        }
+
+        BatchExecutor executor(threadCount, dispatchMode);
+        auto start = Clock::now();
+        executor.run(jobs);
+        double elapsed = ElapsedMs(start, Clock::now());
+
+        bool ok = true;
+        for (auto& job : jobs) {
+            if (!job.error.empty()) {
+                fprintf(stderr, "%s\n", job.error.c_str());
+                ok = false;
+            }
+        }
+
+        printf(",\n  \"batch\": { \"threads\": %d, \"programs\": %d, \"elapsed_ms\": %.4f, \"programs_per_sec\": %.1f }",
+            executor.getThreadCount(), (int)jobs.size(), elapsed, elapsed > 0 ? jobs.size() / (elapsed / 1000.0) : 0.0);
+        return ok;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int iterations = 5;
+    DispatchMode dispatchMode = DispatchMode::Threaded;
+    const char* dispatchName = "threaded";
+    const char* cacheDirectory = nullptr;
+    int threadCount = 0;
+    TraceOptions traceOptions;
+    std::vector<std::string> files;
+
+    for (int ix = 1; ix < argc; ++ix) {
+        if (strcmp(argv[ix], "--iterations") == 0 && ix + 1 < argc) {
+            iterations = atoi(argv[++ix]);
+        } else if (strcmp(argv[ix], "--dispatch") == 0 && ix + 1 < argc) {
+            dispatchName = argv[++ix];
+            if (!ParseDispatchMode(dispatchName, dispatchMode)) {
+                fprintf(stderr, "Unknown dispatch mode: %s\n", dispatchName);
+                return 1;
+            }
+        } else if (strcmp(argv[ix], "--cache") == 0 && ix + 1 < argc) {
+            cacheDirectory = argv[++ix];
+        } else if (strcmp(argv[ix], "--jobs") == 0 && ix + 1 < argc) {
+            threadCount = atoi(argv[++ix]);
+            if (threadCount < 1) {
+                fprintf(stderr, "Invalid job count: %s\n", argv[ix]);
+                return 1;
+            }
+        } else if (strcmp(argv[ix], "--trace-hot") == 0 && ix + 1 < argc) {
+            traceOptions.hotThreshold = atoi(argv[++ix]);
+        } else if (strcmp(argv[ix], "--trace-length") == 0 && ix + 1 < argc) {
+            traceOptions.maxLength = atoi(argv[++ix]);
+        } else if (strcmp(argv[ix], "--trace-attempts") == 0 && ix + 1 < argc) {
+            traceOptions.maxAttempts = atoi(argv[++ix]);
+        } else {
+            files.push_back(argv[ix]);
+        }
+    }
+
+    if (files.empty() || iterations < 1 ||
+        traceOptions.hotThreshold < 1 || traceOptions.maxLength < 1 || traceOptions.maxAttempts < 0) {
+        fprintf(stderr, "usage: zbbench [--iterations N] [--dispatch call|threaded|native|tracing] [--cache dir] [--jobs N]\n"
+                        "               [--trace-hot N] [--trace-length N] [--trace-attempts N] file.bas...\n");
+        return 1;
+    }
+
+    CompileCache* cache = cacheDirectory ? new CompileCache(cacheDirectory) : nullptr;
+
+    bool ok = true;
+    printf("{\n  \"dispatch\": \"%s\",\n  \"iterations\": %d,\n", dispatchName, iterations);
+    if (dispatchMode == DispatchMode::Tracing) {
+        printf("  \"trace_options\": { \"hot_threshold\": %d, \"max_length\": %d, \"max_attempts\": %d },\n",
+            traceOptions.hotThreshold, traceOptions.maxLength, traceOptions.maxAttempts);
+    }
+    printf("  \"benchmarks\": [\n");
+    bool first = true;
+    for (auto& file : files) {
+        if (RunBenchmark(file, iterations, dispatchMode, traceOptions, cache, first))
+            first = false;
+        else
+            ok = false;
+    }
+    printf("\n  ]");
+    if (cache) {
+        auto& statistics = cache->getStatistics();
+        printf(",\n  \"cache\": { \"hits\": %llu, \"misses\": %llu, \"stores\": %llu, \"evictions\": %llu }",
+            (unsigned long long)statistics.hits, (unsigned long long)statistics.misses,
+            (unsigned long long)statistics.stores, (unsigned long long)statistics.evictions);
+        delete cache;
+    }
+    if (threadCount > 0 && !RunBatch(files, iterations, dispatchMode, threadCount))
+        ok = false;
+    printf("\n}\n");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,352 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "GlyphAtlas.h"
+#include "GlyphRasterizer.h"
+#include "Lexer.h"
+#include "MemoryManager.h"
+#include "MemoryPool.h"
+#include "Stack.h"
+#include "StringPool.h"
+#include "TextSourceStream.h"
+#include "TItemBuffer.h"
+#include "TObjectList.h"
+#include "TObjectPool.h"
+#include "Token.h"
+
+extern uint32_t font8x16[];
+
+// Microbenchmarks for the core data structures.  Each benchmark runs a batch
+// of operations several times and keeps the fastest run; allocations are
+// counted by replacing the global operator new, so setup done inside a batch
+// (constructing a pool, say) is amortized into the per-op figures.  The glyph
+// benchmarks draw a full 80x25 screen per batch and count one op per cell.
+// Results are written to stdout as JSON:
+//
+//     zbmicrobench [--runs N] [--max-lines N] [name-filter]
+
+static uint64_t gAllocations = 0;
+static uint64_t gAllocatedBytes = 0;
+
+void* operator new(size_t size)
+{
+    ++gAllocations;
+    gAllocatedBytes += size;
+    void* memory = malloc(size ? size : 1);
+    if (!memory)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    free(memory);
+}
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // keeps results alive so the optimizer can't discard the work
+    volatile int64_t gSink = 0;
+
+    int gRuns = 5;
+    const char* gFilter = nullptr;
+    bool gFirst = true;
+
+    template<typename Fn>
+    void Measure(const std::string& name, uint64_t opsPerRun, Fn&& run)
+    {
+        if (gFilter && name.find(gFilter) == std::string::npos)
+            return;
+
+        // warm up caches and the allocator
+        run();
+
+        double best = 0;
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+        for (int ix = 0; ix < gRuns; ++ix) {
+            uint64_t startAllocations = gAllocations;
+            uint64_t startBytes = gAllocatedBytes;
+            auto start = Clock::now();
+            run();
+            double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            allocations += gAllocations - startAllocations;
+            bytes += gAllocatedBytes - startBytes;
+            if (ix == 0 || elapsed < best)
+                best = elapsed;
+        }
+
+        double totalOps = double(opsPerRun) * gRuns;
+        printf("%s    { \"name\": \"%s\", \"ops\": %llu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f, \"bytes_per_op\": %.2f }",
+            gFirst ? "" : ",\n", name.c_str(), (unsigned long long)opsPerRun, best / opsPerRun, allocations / totalOps, bytes / totalOps);
+        gFirst = false;
+    }
+
+    void BenchMemoryManager()
+    {
+        const int kOps = 100000;
+        const char* shortText = "sixteen chars!!!";
+        std::string longText(200, 'x');
+
+        Measure("MemoryManager/newString+delMemory/16", kOps, [&] {
+            MemoryManager memoryManager;
+            for (int ix = 0; ix < kOps; ++ix)
+                memoryManager.delMemory(memoryManager.newString(shortText, 16));
+        });
+
+        Measure("MemoryManager/newString+delMemory/200", kOps, [&] {
+            MemoryManager memoryManager;
+            for (int ix = 0; ix < kOps; ++ix)
+                memoryManager.delMemory(memoryManager.newString(longText.data(), (int)longText.length()));
+        });
+
+        Measure("MemoryManager/addStrings", kOps, [&] {
+            MemoryManager memoryManager;
+            int64_t lhs = memoryManager.newString(shortText, 16);
+            int64_t rhs = memoryManager.newString(shortText, 16);
+            for (int ix = 0; ix < kOps; ++ix)
+                memoryManager.delMemory(memoryManager.addStrings(lhs, rhs));
+        });
+
+        Measure("MemoryManager/compareStrings", kOps, [&] {
+            MemoryManager memoryManager;
+            int64_t lhs = memoryManager.newString(longText.data(), (int)longText.length());
+            int64_t rhs = memoryManager.newString(longText.data(), (int)longText.length());
+            int64_t total = 0;
+            for (int ix = 0; ix < kOps; ++ix)
+                total += memoryManager.compareStrings(lhs, rhs);
+            gSink = total;
+        });
+    }
+
+    void BenchStack()
+    {
+        const int kOps = 1000000;
+
+        Measure("Stack/push+pop", kOps, [&] {
+            Stack stack;
+            for (int ix = 0; ix < kOps; ++ix)
+                stack.push(ix);
+            int64_t total = 0;
+            for (int ix = 0; ix < kOps; ++ix)
+                total += stack.pop();
+            gSink = total;
+        });
+
+        Measure("Stack/getLocal", kOps, [&] {
+            Stack stack;
+            stack.reserve(256);
+            int64_t total = 0;
+            for (int ix = 0; ix < kOps; ++ix)
+                total += stack.getLocal(ix & 255);
+            gSink = total;
+        });
+    }
+
+    void BenchPools()
+    {
+        const int kOps = 1000000;
+
+        Measure("TItemBuffer/alloc", kOps, [&] {
+            TItemBuffer<int64_t> buffer(16);
+            for (int ix = 0; ix < kOps; ++ix)
+                *buffer.alloc(1) = ix;
+            gSink = buffer.getSize();
+        });
+
+        Measure("MemoryPool/allocItems", kOps, [&] {
+            MemoryPool pool(16, 4096);
+            for (int ix = 0; ix < kOps; ++ix)
+                gSink = (int64_t)(intptr_t)pool.allocItems(1);
+        });
+
+        Measure("StringPool/alloc", kOps, [&] {
+            StringPool pool;
+            for (int ix = 0; ix < kOps; ++ix)
+                gSink = pool.alloc("identifier12", 12).getLength();
+        });
+    }
+
+    // Window::renderCell as it was before the rasterizer, for comparison
+    void RenderCellBitShift(char ch, uint32_t fg, uint32_t bg, uint32_t* pixel, int pitch)
+    {
+        uint8_t* chr = (uint8_t*)font8x16 + ((uint8_t)ch * 16);
+        uint32_t colr[2] = { bg, fg };
+
+        for (int y = 0; y < 16; ++y) {
+            *(pixel) = colr[(*chr & 0x80) >> 7];
+            *(pixel + 1) = colr[(*chr & 0x40) >> 6];
+            *(pixel + 2) = colr[(*chr & 0x20) >> 5];
+            *(pixel + 3) = colr[(*chr & 0x10) >> 4];
+            *(pixel + 4) = colr[(*chr & 0x8) >> 3];
+            *(pixel + 5) = colr[(*chr & 0x4) >> 2];
+            *(pixel + 6) = colr[(*chr & 0x2) >> 1];
+            *(pixel + 7) = colr[*chr & 0x1];
+            ++chr;
+            pixel += pitch;
+        }
+    }
+
+    void BenchGlyphs()
+    {
+        const int kFrames = 100;
+        const int kCells = 80 * 25;
+        const int kPitch = 640;
+        const uint32_t palette[16] = {
+            0x000000, 0x0000aa, 0x00aa00, 0x00aaaa, 0xaa0000, 0xaa00aa, 0xaa5500, 0xaaaaaa,
+            0x555555, 0x5555ff, 0x55ff55, 0x55ffff, 0xff5555, 0xff55ff, 0xffff55, 0xffffff
+        };
+
+        std::vector<GlyphCell> cells(kCells);
+        for (int ix = 0; ix < kCells; ++ix) {
+            cells[ix].ch = (char)(32 + (ix % 95));
+            cells[ix].color = (uint8_t)(0x17 + (ix % 3));
+        }
+        std::vector<uint32_t> screen(640 * 400);
+
+        Measure("Glyph/bitShift", kFrames * kCells, [&] {
+            for (int frame = 0; frame < kFrames; ++frame) {
+                for (int ix = 0; ix < kCells; ++ix) {
+                    uint32_t* pixels = &screen[((ix / 80) * 16 * kPitch) + ((ix % 80) * 8)];
+                    RenderCellBitShift(cells[ix].ch, palette[cells[ix].color & 0xf], palette[cells[ix].color >> 4], pixels, kPitch);
+                }
+            }
+            gSink = screen[kPitch + 1];
+        });
+
+        Measure(std::string("Glyph/rasterizeGlyph/") + getGlyphRasterizerPath(), kFrames * kCells, [&] {
+            for (int frame = 0; frame < kFrames; ++frame) {
+                for (int ix = 0; ix < kCells; ++ix) {
+                    uint32_t* pixels = &screen[((ix / 80) * 16 * kPitch) + ((ix % 80) * 8)];
+                    rasterizeGlyph(cells[ix].ch, palette[cells[ix].color & 0xf], palette[cells[ix].color >> 4], pixels, kPitch);
+                }
+            }
+            gSink = screen[kPitch + 1];
+        });
+
+        Measure(std::string("Glyph/rasterizeCells/") + getGlyphRasterizerPath(), kFrames * kCells, [&] {
+            for (int frame = 0; frame < kFrames; ++frame) {
+                for (int row = 0; row < 25; ++row)
+                    rasterizeCells(&cells[row * 80], 80, palette, &screen[row * 16 * kPitch], kPitch);
+            }
+            gSink = screen[kPitch + 1];
+        });
+
+        // every glyph is already in the atlas after the warm-up run
+        GlyphAtlas atlas;
+        Measure("Glyph/atlas", kFrames * kCells, [&] {
+            for (int frame = 0; frame < kFrames; ++frame) {
+                for (int row = 0; row < 25; ++row)
+                    atlas.drawCells(&cells[row * 80], 80, &screen[row * 16 * kPitch], kPitch);
+            }
+            gSink = screen[kPitch + 1];
+        });
+    }
+
+    std::string MakeSource(int lines)
+    {
+        static const char* const templates[] = {
+            "LET Total = Total + I * 42 MOD 7\n",
+            "IF Name$ = \"hello world\" THEN PRINT \"match\"; Count\n",
+            "FOR I = 1 TO 100 STEP 2\n",
+            "NEXT I\n",
+            "Label1:\n",
+            "LET R = R * 1.5 + 0.25\n",
+            "GOTO Label1\n",
+            "PRINT LEFT$(S$, 3); LEN(S$)\n"
+        };
+
+        std::string source;
+        for (int ix = 0; ix < lines; ++ix)
+            source += templates[ix % (sizeof(templates) / sizeof(templates[0]))];
+        return source;
+    }
+
+    void BenchLexer(int maxLines)
+    {
+        for (int lines = 1000; lines <= maxLines; lines *= 10) {
+            std::string source = MakeSource(lines);
+
+            Measure("Lexer/run/" + std::to_string(lines), lines, [&] {
+                TObjectPool<Token> tokenPool(256);
+                TObjectList<Token> tokens;
+                StringPool stringPool;
+                TextSourceStream stream(source.data(), (int)source.length());
+                Lexer lexer(tokenPool, tokens, stringPool, stream);
+                lexer.run();
+                gSink = tokens.getSize();
+            });
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int maxLines = 1000000;
+
+    for (int ix = 1; ix < argc; ++ix) {
+        if (strcmp(argv[ix], "--runs") == 0 && ix + 1 < argc)
+            gRuns = std::max(1, atoi(argv[++ix]));
+        else if (strcmp(argv[ix], "--max-lines") == 0 && ix + 1 < argc)
+            maxLines = atoi(argv[++ix]);
+        else
+            gFilter = argv[ix];
+    }
+
+    printf("{\n  \"runs\": %d,\n  \"benchmarks\": [\n", gRuns);
+    BenchMemoryManager();
+    BenchStack();
+    BenchPools();
+    BenchLexer(maxLines);
+    BenchGlyphs();
+    printf("\n  ]\n}\n");
+
+    return 0;
+}
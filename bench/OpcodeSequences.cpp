@@ -0,0 +1,245 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "CompileError.h"
+#include "Compiler.h"
+#include "Instructions.h"
+#include "Interpreter.h"
+#include "NullConsole.h"
+#include "Opcodes.h"
+#include "SourceFile.h"
+#include "TextSourceStream.h"
+
+// Superinstruction selection.  Each program is run once in
+// DispatchMode::Sequencing and the counts of instructions that executed back
+// to back are added up across all of them.  The most frequent pairs and
+// triples are written to stdout as JSON; with --generate, the top ones are
+// also written out as the superinstruction lists the interpreter is built
+// with (see Superinstructions.h):
+//
+//     zbsequences [--top N] [--generate file.h] file.bas...
+
+namespace
+{
+    typedef std::tuple<VmWord, VmWord, VmWord> SequenceKey;
+    typedef std::map<SequenceKey, uint64_t> SequenceTotals;
+
+    const char* kLicense =
+        "// BSD 3-Clause License\n"
+        "//\n"
+        "// Copyright (c) 2018, Jason Hoyt\n"
+        "// All rights reserved.\n"
+        "//\n"
+        "// Redistribution and use in source and binary forms, with or without\n"
+        "// modification, are permitted provided that the following conditions are met:\n"
+        "//\n"
+        "// * Redistributions of source code must retain the above copyright notice, this\n"
+        "//   list of conditions and the following disclaimer.\n"
+        "//\n"
+        "// * Redistributions in binary form must reproduce the above copyright notice,\n"
+        "//   this list of conditions and the following disclaimer in the documentation\n"
+        "//   and/or other materials provided with the distribution.\n"
+        "//\n"
+        "// * Neither the name of the copyright holder nor the names of its\n"
+        "//   contributors may be used to endorse or promote products derived from\n"
+        "//   this software without specific prior written permission.\n"
+        "//\n"
+        "// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\"\n"
+        "// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE\n"
+        "// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE\n"
+        "// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE\n"
+        "// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL\n"
+        "// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR\n"
+        "// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER\n"
+        "// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,\n"
+        "// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE\n"
+        "// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.\n"
+        ;
+
+    std::string GetBaseName(const std::string& filename)
+    {
+        size_t start = filename.find_last_of("/\\");
+        return start == std::string::npos ? filename : filename.substr(start + 1);
+    }
+
+    // returns false if the program didn't compile
+    bool CountSequences(const std::string& filename, SequenceTotals& pairs, SequenceTotals& triples, uint64_t& instructions)
+    {
+        std::string code;
+        if (!readSourceFile(filename, code)) {
+            fprintf(stderr, "Failed to open file: %s\n", filename.c_str());
+            return false;
+        }
+
+        try {
+            Compiler compiler;
+            NullConsole console;
+            TextSourceStream stream(code.data(), (int)code.length());
+            auto program = compiler.run(stream);
+            Interpreter interpreter(console, program, DispatchMode::Sequencing);
+            interpreter.run();
+
+            auto& counter = interpreter.getSequenceCounter();
+            instructions += counter.getExecutedCount();
+            for (auto& sequence : counter.getSequences(2))
+                pairs[std::make_tuple(sequence.opcodes[0], sequence.opcodes[1], 0)] += sequence.count;
+            for (auto& sequence : counter.getSequences(3))
+                triples[std::make_tuple(sequence.opcodes[0], sequence.opcodes[1], sequence.opcodes[2])] += sequence.count;
+        }
+        catch (const CompileError& error) {
+            fprintf(stderr, "%s\n", formatCompileError(filename, error).c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // most frequent first, leaving out anything that ends the program since
+    // END is how threaded dispatch exits
+    std::vector<std::pair<SequenceKey, uint64_t>> Rank(const SequenceTotals& totals, int length, size_t top)
+    {
+        std::vector<std::pair<SequenceKey, uint64_t>> ranked;
+        for (auto& entry : totals) {
+            if (std::get<0>(entry.first) == Op_end || std::get<1>(entry.first) == Op_end)
+                continue;
+            if (length == 3 && std::get<2>(entry.first) == Op_end)
+                continue;
+            ranked.push_back(entry);
+        }
+        std::stable_sort(ranked.begin(), ranked.end(), [](const std::pair<SequenceKey, uint64_t>& lhs, const std::pair<SequenceKey, uint64_t>& rhs) {
+            return lhs.second > rhs.second;
+        });
+        if (ranked.size() > top)
+            ranked.resize(top);
+        return ranked;
+    }
+
+    std::string GetNames(const SequenceKey& key, int length, const char* separator)
+    {
+        std::string names = getInstructionName(std::get<0>(key));
+        names += separator;
+        names += getInstructionName(std::get<1>(key));
+        if (length == 3) {
+            names += separator;
+            names += getInstructionName(std::get<2>(key));
+        }
+        return names;
+    }
+
+    void PrintSequences(const char* name, const std::vector<std::pair<SequenceKey, uint64_t>>& ranked, int length, uint64_t instructions, bool last)
+    {
+        printf("  \"%s\": [", name);
+        for (size_t ix = 0; ix < ranked.size(); ++ix) {
+            printf("%s\n    { \"sequence\": [\"%s\"], \"count\": %llu, \"percent\": %.2f }",
+                ix ? "," : "", GetNames(ranked[ix].first, length, "\", \"").c_str(),
+                (unsigned long long)ranked[ix].second,
+                instructions ? 100.0 * (double)ranked[ix].second / (double)instructions : 0.0);
+        }
+        printf("\n  ]%s\n", last ? "" : ",");
+    }
+
+    bool Generate(const char* filename,
+                  const std::vector<std::string>& files,
+                  const std::vector<std::pair<SequenceKey, uint64_t>>& pairs,
+                  const std::vector<std::pair<SequenceKey, uint64_t>>& triples)
+    {
+        FILE* file = fopen(filename, "wb");
+        if (!file) {
+            fprintf(stderr, "Failed to create file: %s\n", filename);
+            return false;
+        }
+
+        fprintf(file, "%s#pragma once\n\n", kLicense);
+        fprintf(file, "// Generated by zbsequences from the most frequent runs of instructions in:\n//\n");
+        for (auto& name : files)
+            fprintf(file, "//     %s\n", GetBaseName(name).c_str());
+        fprintf(file, "//\n// Regenerate with `make sequences` rather than editing by hand.\n\n");
+
+        fprintf(file, "#define SUPERINSTRUCTION_PAIRS(X)");
+        for (auto& pair : pairs)
+            fprintf(file, " \\\n    X(%s)", GetNames(pair.first, 2, ", ").c_str());
+        fprintf(file, "\n\n#define SUPERINSTRUCTION_TRIPLES(X)");
+        for (auto& triple : triples)
+            fprintf(file, " \\\n    X(%s)", GetNames(triple.first, 3, ", ").c_str());
+        fprintf(file, "\n");
+
+        fclose(file);
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int top = 8;
+    const char* output = nullptr;
+    std::vector<std::string> files;
+
+    for (int ix = 1; ix < argc; ++ix) {
+        if (strcmp(argv[ix], "--top") == 0 && ix + 1 < argc)
+            top = atoi(argv[++ix]);
+        else if (strcmp(argv[ix], "--generate") == 0 && ix + 1 < argc)
+            output = argv[++ix];
+        else
+            files.push_back(argv[ix]);
+    }
+
+    if (files.empty() || top < 1) {
+        fprintf(stderr, "usage: zbsequences [--top N] [--generate file.h] file.bas...\n");
+        return 1;
+    }
+
+    SequenceTotals pairs;
+    SequenceTotals triples;
+    uint64_t instructions = 0;
+    bool ok = true;
+    for (auto& file : files)
+        ok = CountSequences(file, pairs, triples, instructions) && ok;
+
+    auto topPairs = Rank(pairs, 2, top);
+    auto topTriples = Rank(triples, 3, top);
+
+    printf("{\n  \"instructions\": %llu,\n", (unsigned long long)instructions);
+    PrintSequences("pairs", topPairs, 2, instructions, false);
+    PrintSequences("triples", topTriples, 3, instructions, true);
+    printf("}\n");
+
+    if (output && ok && !Generate(output, files, topPairs, topTriples))
+        ok = false;
+
+    return ok ? 0 : 1;
+}
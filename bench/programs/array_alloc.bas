@@ -0,0 +1,7 @@
+LET Total = 0
+FOR I = 1 TO 20000
+  DIM A(100) AS INTEGER
+  DIM B(1 TO 50) AS INTEGER
+  LET Total = Total + I
+NEXT I
+PRINT "Total "; Total
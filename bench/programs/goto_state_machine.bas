@@ -0,0 +1,30 @@
+LET State = 0
+LET Steps = 0
+LET Acc = 0
+Dispatch:
+LET Steps = Steps + 1
+IF Steps > 500000 THEN GOTO Done
+IF State = 0 THEN GOTO Idle
+IF State = 1 THEN GOTO Running
+IF State = 2 THEN GOTO Paused
+GOTO Stopped
+Idle:
+LET Acc = Acc + 1
+LET State = 1
+GOTO Dispatch
+Running:
+LET Acc = Acc + 3
+IF Acc MOD 5 = 0 THEN LET State = 2
+IF Acc MOD 5 <> 0 THEN LET State = 3
+GOTO Dispatch
+Paused:
+LET Acc = Acc - 1
+LET State = 1
+GOTO Dispatch
+Stopped:
+LET Acc = Acc + 2
+LET State = 0
+GOTO Dispatch
+Done:
+PRINT "Acc "; Acc
+END
@@ -0,0 +1,7 @@
+LET Total = 0
+FOR I = 1 TO 2000
+  FOR J = 1 TO 500
+    LET Total = Total + I * J MOD 7
+  NEXT J
+NEXT I
+PRINT "Total "; Total
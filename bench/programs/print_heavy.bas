@@ -0,0 +1,3 @@
+FOR I = 1 TO 20000
+  PRINT "Line "; I; " of output, square "; I * I
+NEXT I
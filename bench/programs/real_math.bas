@@ -0,0 +1,10 @@
+DIM X AS REAL
+DIM Y AS REAL
+LET X = 0.5
+LET Y = 0.0
+FOR I = 1 TO 200000
+  LET X = X * 1.0001 + 0.5
+  IF X > 1000.0 THEN LET X = X - 999.5
+  LET Y = Y + X / 3.0
+NEXT I
+PRINT X; " "; Y
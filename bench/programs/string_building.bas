@@ -0,0 +1,10 @@
+LET Count = 0
+FOR I = 1 TO 2000
+  LET S$ = ""
+  FOR J = 1 TO 40
+    LET S$ = S$ + "ab"
+  NEXT J
+  LET T$ = LEFT$(S$, 25)
+  IF T$ = "ababababababababababababa" THEN LET Count = Count + LEN(S$)
+NEXT I
+PRINT "Count "; Count
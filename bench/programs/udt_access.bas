@@ -0,0 +1,20 @@
+TYPE Particle
+  X AS INTEGER
+  Y AS INTEGER
+  DX AS INTEGER
+  DY AS INTEGER
+END TYPE
+DIM P AS Particle
+LET P.X = 0
+LET P.Y = 0
+LET P.DX = 3
+LET P.DY = -2
+FOR I = 1 TO 200000
+  LET P.X = P.X + P.DX
+  LET P.Y = P.Y + P.DY
+  IF P.X > 1000 THEN LET P.DX = -3
+  IF P.X < 0 THEN LET P.DX = 3
+  IF P.Y < -1000 THEN LET P.DY = 2
+  IF P.Y > 0 THEN LET P.DY = -2
+NEXT I
+PRINT P.X; " "; P.Y
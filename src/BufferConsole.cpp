@@ -0,0 +1,96 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+#include "BufferConsole.h"
+
+BufferConsole::BufferConsole()
+    :
+    mOutput(),
+    mText()
+{
+    // intentionally left blank
+}
+
+BufferConsole::~BufferConsole()
+{
+    // intentionally left blank
+}
+
+void BufferConsole::print(const char* text)
+{
+    printn(text, (int)strlen(text));
+}
+
+void BufferConsole::printf(const char* format, ...)
+{
+    char buf[1024];
+    va_list ap;
+
+    va_start(ap, format);
+#ifdef _WIN32
+    int len = vsprintf_s(buf, sizeof(buf), format, ap);
+#else
+    int len = vsnprintf(buf, sizeof(buf), format, ap);
+#endif
+    va_end(ap);
+
+    printn(buf, len);
+}
+
+void BufferConsole::printn(const char* text, int len)
+{
+    if (len <= 0)
+        return;
+
+    // like Window, text shorter than len is padded out with spaces
+    int textLen = (int)strnlen(text, len);
+    mOutput.append(text, textLen);
+    mOutput.append(len - textLen, ' ');
+}
+
+const std::string& BufferConsole::input(int maxLength, bool allowEscape, bool moveToNextLine)
+{
+    mText.clear();
+    return mText;
+}
+
+void BufferConsole::locate(int row, int col)
+{
+    // intentionally left blank
+}
+
+void BufferConsole::color(int fg, int bg)
+{
+    // intentionally left blank
+}
@@ -0,0 +1,272 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include "BuildId.h"
+#include "CompileCache.h"
+#include "ProgramImage.h"
+
+namespace
+{
+    struct CacheEntry
+    {
+        std::string path;
+        uint64_t size;
+        uint64_t time;
+        bool temporary;
+    };
+
+    // a temporary file this old was left by a process that died before
+    // renaming it into place
+    const uint64_t kStaleSeconds = 60 * 60;
+
+    // 64-bit FNV-1a
+    uint64_t Hash(uint64_t hash, const void* data, size_t size)
+    {
+        auto bytes = (const uint8_t*)data;
+        for (size_t ix = 0; ix < size; ++ix) {
+            hash ^= bytes[ix];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    bool EndsWith(const std::string& text, const char* suffix)
+    {
+        size_t length = strlen(suffix);
+        return text.length() >= length && text.compare(text.length() - length, length, suffix) == 0;
+    }
+
+    void Touch(const std::string& path)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        FILETIME now;
+        GetSystemTimeAsFileTime(&now);
+        SetFileTime(file, nullptr, nullptr, &now);
+        CloseHandle(file);
+#else
+        utime(path.c_str(), nullptr);
+#endif
+    }
+
+    bool Rename(const std::string& from, const std::string& to)
+    {
+#ifdef _WIN32
+        return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        return rename(from.c_str(), to.c_str()) == 0;
+#endif
+    }
+
+    // in the units of CacheEntry::time
+    uint64_t GetTime()
+    {
+#ifdef _WIN32
+        FILETIME now;
+        GetSystemTimeAsFileTime(&now);
+        return ((uint64_t)now.dwHighDateTime << 32) | now.dwLowDateTime;
+#else
+        return (uint64_t)time(nullptr);
+#endif
+    }
+
+    uint64_t GetStaleAge()
+    {
+#ifdef _WIN32
+        return kStaleSeconds * 10000000;
+#else
+        return kStaleSeconds;
+#endif
+    }
+
+    // entries and the temporary files they're written to
+    std::vector<CacheEntry> ListEntries(const std::string& directory)
+    {
+        std::vector<CacheEntry> entries;
+#ifdef _WIN32
+        WIN32_FIND_DATAA data;
+        HANDLE find = FindFirstFileA((directory + "\\*.zbc*").c_str(), &data);
+        if (find == INVALID_HANDLE_VALUE)
+            return entries;
+        do {
+            std::string name = data.cFileName;
+            if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) || (!EndsWith(name, ".zbc") && !EndsWith(name, ".tmp")))
+                continue;
+            CacheEntry entry;
+            entry.path = directory + "\\" + name;
+            entry.size = ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+            entry.time = ((uint64_t)data.ftLastWriteTime.dwHighDateTime << 32) | data.ftLastWriteTime.dwLowDateTime;
+            entry.temporary = EndsWith(name, ".tmp");
+            entries.push_back(entry);
+        } while (FindNextFileA(find, &data));
+        FindClose(find);
+#else
+        DIR* dir = opendir(directory.c_str());
+        if (!dir)
+            return entries;
+        while (struct dirent* item = readdir(dir)) {
+            std::string name = item->d_name;
+            if (!EndsWith(name, ".zbc") && !EndsWith(name, ".tmp"))
+                continue;
+            CacheEntry entry;
+            entry.path = directory + "/" + name;
+            entry.temporary = EndsWith(name, ".tmp");
+            struct stat status;
+            if (stat(entry.path.c_str(), &status) != 0 || !S_ISREG(status.st_mode))
+                continue;
+            entry.size = (uint64_t)status.st_size;
+            entry.time = (uint64_t)status.st_mtime;
+            entries.push_back(entry);
+        }
+        closedir(dir);
+#endif
+        return entries;
+    }
+}
+
+CompileCache::CompileCache(const std::string& directory, uint64_t maxSize)
+    :
+    mDirectory(directory),
+    mMaxSize(maxSize),
+    mStatistics(),
+    mTemporaryCount(0)
+{
+    // the directory may already exist, or be created by another process
+#ifdef _WIN32
+    CreateDirectoryA(mDirectory.c_str(), nullptr);
+#else
+    mkdir(mDirectory.c_str(), 0777);
+#endif
+}
+
+CompileCache::~CompileCache()
+{
+    // intentionally left blank
+}
+
+bool CompileCache::load(const std::string& source, ProgramImage& image)
+{
+    std::string path = getPath(source);
+    std::string error;
+    // the name is only a 64-bit hash, so a hit must also have been compiled
+    // from exactly this source
+    if (!image.load(path, error) || !image.isCompiledFrom(source)) {
+        image.unload();
+        ++mStatistics.misses;
+        return false;
+    }
+    Touch(path);
+    ++mStatistics.hits;
+    return true;
+}
+
+void CompileCache::store(const std::string& source, const Program& program)
+{
+    // the cache is only an optimization, so failures here are ignored
+    std::string path = getPath(source);
+    char suffix[64];
+#ifdef _WIN32
+    snprintf(suffix, sizeof(suffix), ".%lu.%p.%u.tmp", (unsigned long)GetCurrentProcessId(), (void*)this, mTemporaryCount++);
+#else
+    snprintf(suffix, sizeof(suffix), ".%ld.%p.%u.tmp", (long)getpid(), (void*)this, mTemporaryCount++);
+#endif
+    std::string temporary = path + suffix;
+
+    std::string error;
+    if (!ProgramImage::save(program, source, temporary, error) || !Rename(temporary, path)) {
+        remove(temporary.c_str());
+        return;
+    }
+    ++mStatistics.stores;
+    evict(path);
+}
+
+std::string CompileCache::getPath(const std::string& source) const
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    uint64_t buildId = getBuildId();
+    hash = Hash(hash, &kProgramImageVersion, sizeof(kProgramImageVersion));
+    hash = Hash(hash, &buildId, sizeof(buildId));
+    hash = Hash(hash, source.data(), source.length());
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.zbc", (unsigned long long)hash);
+#ifdef _WIN32
+    return mDirectory + "\\" + name;
+#else
+    return mDirectory + "/" + name;
+#endif
+}
+
+void CompileCache::evict(const std::string& keep)
+{
+    // temporary files count toward the size until they're renamed, and are
+    // only removed once stale, since another process may be writing one
+    auto entries = ListEntries(mDirectory);
+    uint64_t now = GetTime();
+    uint64_t total = 0;
+    for (auto& entry : entries) {
+        if (entry.temporary && entry.time + GetStaleAge() < now && remove(entry.path.c_str()) == 0)
+            entry.size = 0;
+        total += entry.size;
+    }
+    if (total <= mMaxSize)
+        return;
+
+    // oldest first, never removing the entry that was just stored
+    std::sort(entries.begin(), entries.end(), [](const CacheEntry& lhs, const CacheEntry& rhs) {
+        return lhs.time < rhs.time;
+    });
+    for (auto& entry : entries) {
+        if (total <= mMaxSize)
+            break;
+        if (!entry.temporary && entry.path != keep && remove(entry.path.c_str()) == 0) {
+            total -= entry.size;
+            ++mStatistics.evictions;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class Program;
+class ProgramImage;
+
+struct CompileCacheStatistics
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;
+    uint64_t evictions;
+};
+
+// On-disk cache of compiled programs.  Each entry is a program image (see
+// ProgramImage) named after a hash of the source text, the image version and
+// the build ID, so a hit skips compiling entirely, and an edit or a new build
+// of zb simply misses.  Since names can collide, a hit is only used if the
+// image's recorded source length and SHA-256 match the source.  Entries are
+// written to a temporary file and renamed into place, so other processes
+// sharing the directory never see half of one.  A hit touches the entry's
+// modification time, and after each store the least recently used entries are
+// removed until the directory fits in its size limit.  Temporary files count
+// toward the limit too, and ones left by a process that died before renaming
+// them are removed once they're an hour old.
+class CompileCache
+{
+public:
+    explicit CompileCache(const std::string& directory, uint64_t maxSize = 64 * 1024 * 1024);
+    ~CompileCache();
+
+    bool load(const std::string& source, ProgramImage& image);
+    void store(const std::string& source, const Program& program);
+
+    const CompileCacheStatistics& getStatistics() const
+    {
+        return mStatistics;
+    }
+
+private:
+    std::string mDirectory;
+    uint64_t mMaxSize;
+    CompileCacheStatistics mStatistics;
+    unsigned mTemporaryCount;
+
+    std::string getPath(const std::string& source) const;
+    void evict(const std::string& keep);
+};
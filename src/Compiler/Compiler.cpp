@@ -28,10 +28,16 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <string>
+
 #include "Analyzer.h"
+#include "CompileCache.h"
+#include "CompileError.h"
 #include "Compiler.h"
 #include "Lexer.h"
 #include "Parser.h"
+#include "TextSourceStream.h"
 #include "Translator.h"
 
 Compiler::Compiler()
@@ -43,8 +49,15 @@ Compiler::Compiler()
     mBytecode(256),
     mStringTable(mStringPool),
     mConstantTable(),
+    mLineTable(),
     mSymbolTable(),
-    mUserDefinedTypeTable()
+    mUserDefinedTypeTable(),
+    mCache(nullptr),
+    mImage(),
+    mLineTokens(),
+    mLines(),
+    mLinesCompiled(false),
+    mLineText()
 {
     // intentionally left blank
 }
@@ -55,6 +68,88 @@ Compiler::~Compiler()
 }
 
 Program Compiler::run(ISourceStream& source)
+{
+    mImage.unload();
+    mLinesCompiled = false;
+    if (!mCache)
+        return compile(source);
+
+    // the cache is keyed on the whole text, so it's read up front
+    std::string text;
+    for (char ch = source.read(); ch != ISourceStream::EndOfStream; ch = source.read())
+        text += ch;
+    if (mCache->load(text, mImage))
+        return mImage.getProgram();
+
+    TextSourceStream stream(text.data(), (int)text.length());
+    auto program = compile(stream);
+    mCache->store(text, program);
+    return program;
+}
+
+Program Compiler::run(const std::vector<StringPiece>& lines)
+{
+    mImage.unload();
+
+    // unchanged since the last run, whose program is still intact
+    if (mLinesCompiled && lines.size() == mLines.size() &&
+        std::equal(lines.begin(), lines.end(), mLines.begin(), [](const StringPiece& line, const std::string& text) {
+            return line.exactCompareWithCase(text);
+        }))
+        return Program(&mBytecode[0], mBytecode.getSize(), mStringTable, mConstantTable, mLineTable);
+    mLinesCompiled = false;
+
+    reset();
+
+    // lines not seen in this run are dropped from the cache afterward
+    std::unordered_map<std::string, LineTokens> lineTokens;
+    std::vector<std::string> texts;
+    texts.reserve(lines.size());
+    try {
+        for (size_t ix = 0; ix < lines.size(); ++ix) {
+            int row = (int)ix + 1;
+            std::string text(lines[ix].getText(), lines[ix].getLength());
+            auto entry = lineTokens.find(text);
+            if (entry != lineTokens.end()) {
+                replayLine(entry->second, row);
+            } else {
+                auto cached = mLineTokens.find(text);
+                if (cached != mLineTokens.end()) {
+                    entry = lineTokens.emplace(text, std::move(cached->second)).first;
+                    mLineTokens.erase(cached);
+                    replayLine(entry->second, row);
+                } else {
+                    // only cached once the whole line has lexed
+                    LineTokens tokens;
+                    lexLine(text, row, tokens);
+                    lineTokens.emplace(text, std::move(tokens));
+                }
+            }
+            texts.push_back(std::move(text));
+        }
+
+        // end the list the way Lexer::run does
+        if (mTokens.getSize() > 0)
+            mTokens.push(mTokenPool.alloc(TokenId::EndOfLine, TokenTag::None, StringPiece(), Range()));
+        mTokens.push(mTokenPool.alloc(TokenId::EndOfSource, TokenTag::None, StringPiece(), Range()));
+
+        auto program = compileTokens();
+
+        mLineTokens.swap(lineTokens);
+        mLines.swap(texts);
+        mLinesCompiled = true;
+        return program;
+    }
+    catch (const CompileError&) {
+        // a program being typed usually has an error somewhere, so the
+        // lines are kept for the next run rather than lexed again
+        for (auto& entry : lineTokens)
+            mLineTokens.emplace(entry.first, std::move(entry.second));
+        throw;
+    }
+}
+
+void Compiler::reset()
 {
     mTokenPool.reset();
     mTokens.reset();
@@ -63,20 +158,58 @@ Program Compiler::run(ISourceStream& source)
     mBytecode.reset();
     mStringTable.reset();
     mConstantTable.reset();
+    mLineTable.reset();
     mSymbolTable.reset();
     mUserDefinedTypeTable.reset();
+}
+
+Program Compiler::compile(ISourceStream& source)
+{
+    reset();
 
     Lexer lexer(mTokenPool, mTokens, mStringPool, source);
     lexer.run();
 
+    return compileTokens();
+}
+
+Program Compiler::compileTokens()
+{
     Parser parser(mNodePool, mStringPool, mTokens);
     Node& root = parser.run();
 
     Analyzer analyzer(mNodePool, mSymbolTable, mUserDefinedTypeTable, root);
     analyzer.run();
 
-    Translator translator(mBytecode, mStringTable, mConstantTable, mSymbolTable, mUserDefinedTypeTable, root);
+    Translator translator(mBytecode, mStringTable, mConstantTable, mLineTable, mSymbolTable, mUserDefinedTypeTable, root);
     translator.run();
 
-    return Program(&mBytecode[0], mBytecode.getSize(), mStringTable, mConstantTable);
+    return Program(&mBytecode[0], mBytecode.getSize(), mStringTable, mConstantTable, mLineTable);
+}
+
+void Compiler::lexLine(const std::string& text, int row, LineTokens& tokens)
+{
+    mLineText = text;
+    mLineText.push_back('\n');
+
+    int first = mTokens.getSize();
+    TextSourceStream stream(mLineText.data(), (int)mLineText.length(), row);
+    Lexer lexer(mTokenPool, mTokens, mStringPool, stream);
+    lexer.scan();
+
+    // the end of line token ends on the row after
+    for (int ix = first; ix < mTokens.getSize(); ++ix) {
+        auto& token = mTokens[ix];
+        auto& range = token.getRange();
+        tokens.push_back({ token.getId(), token.getTag(), std::string(token.getText().getText(), token.getText().getLength()),
+                           Range(range.getStartRow() - row + 1, range.getStartCol(), range.getEndRow() - row + 1, range.getEndCol()) });
+    }
+}
+
+void Compiler::replayLine(const LineTokens& tokens, int row)
+{
+    for (auto& token : tokens) {
+        Range range(token.range.getStartRow() + row - 1, token.range.getStartCol(), token.range.getEndRow() + row - 1, token.range.getEndCol());
+        mTokens.push(mTokenPool.alloc(token.id, token.tag, StringPiece(token.text.data(), (int)token.text.length()), range));
+    }
 }
@@ -31,10 +31,17 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ConstantTable.h"
+#include "LineTable.h"
 #include "NodePool.h"
 #include "Program.h"
+#include "ProgramImage.h"
+#include "Range.h"
+#include "StringPiece.h"
 #include "StringPool.h"
 #include "StringTable.h"
 #include "SymbolTable.h"
@@ -45,6 +52,7 @@
 #include "UserDefinedTypeTable.h"
 #include "VirtualMachine.h"
 
+class CompileCache;
 class ISourceStream;
 
 class Compiler
@@ -53,9 +61,33 @@ public:
     Compiler();
     ~Compiler();
 
+    // with a cache, programs compiled before are loaded from it instead; the
+    // cache must outlive the compiler
+    void setCache(CompileCache* cache)
+    {
+        mCache = cache;
+    }
+
+    // the program is valid until the next run
     Program run(ISourceStream& source);
 
+    // Compiles a program given as lines, as the IDE has it.  Tokens are kept
+    // per line, keyed by the line's text, so only lines that changed since
+    // the last run are lexed again; if none did, the last program is returned
+    // without compiling at all.
+    Program run(const std::vector<StringPiece>& lines);
+
 private:
+    // a token as lexed on the first line, so it can be moved to any row
+    struct LineToken
+    {
+        TokenId id;
+        TokenTag tag;
+        std::string text;
+        Range range;
+    };
+    typedef std::vector<LineToken> LineTokens;
+
     TObjectPool<Token> mTokenPool;
     TObjectList<Token> mTokens;
     StringPool mStringPool;
@@ -63,6 +95,19 @@ private:
     TItemBuffer<VmWord> mBytecode;
     StringTable mStringTable;
     ConstantTable mConstantTable;
+    LineTable mLineTable;
     SymbolTable mSymbolTable;
     UserDefinedTypeTable mUserDefinedTypeTable;
+    CompileCache* mCache;
+    ProgramImage mImage;
+    std::unordered_map<std::string, LineTokens> mLineTokens;
+    std::vector<std::string> mLines;
+    bool mLinesCompiled;
+    std::string mLineText;
+
+    void reset();
+    Program compile(ISourceStream& source);
+    Program compileTokens();
+    void lexLine(const std::string& text, int row, LineTokens& tokens);
+    void replayLine(const LineTokens& tokens, int row);
 };
@@ -34,7 +34,8 @@
 
 ConstantTable::ConstantTable()
     :
-    mConstants()
+    mConstants(),
+    mIndices()
 {
     // intentionally left blank
 }
@@ -47,17 +48,25 @@ ConstantTable::~ConstantTable()
 void ConstantTable::reset()
 {
     mConstants.clear();
+    mIndices.clear();
 }
 
 int ConstantTable::addInteger(int64_t value)
 {
-    // search for existing value first
-    auto len = (int)mConstants.size();
-    for (auto ix = 0; ix < len; ++ix)
-        if (mConstants[ix] == value)
-            return ix;
-    mConstants.push_back(value);
-    return len;
+    // reuse an existing value first
+    auto entry = mIndices.emplace(value, (int)mConstants.size());
+    if (entry.second)
+        mConstants.push_back(value);
+    return entry.first->second;
+}
+
+void ConstantTable::assign(const int64_t* values, int count)
+{
+    assert(values || count == 0);
+    mConstants.assign(values, values + count);
+    mIndices.clear();
+    for (int ix = 0; ix < count; ++ix)
+        mIndices.emplace(values[ix], ix);
 }
 
 int64_t ConstantTable::getIntegerConstant(int index) const
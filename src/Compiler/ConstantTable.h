@@ -31,6 +31,7 @@
 #pragma once
 
 #include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 class ConstantTable
@@ -43,8 +44,17 @@ public:
 
     int addInteger(int64_t value);
 
+    // replaces the table with constants that are already known to be unique
+    void assign(const int64_t* values, int count);
+
     int64_t getIntegerConstant(int index) const;
 
+    int getSize() const
+    {
+        return (int)mConstants.size();
+    }
+
 private:
     std::vector<int64_t> mConstants;
+    std::unordered_map<int64_t, int> mIndices;
 };
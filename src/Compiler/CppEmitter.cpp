@@ -0,0 +1,444 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cassert>
+#include <cstdarg>
+#include <cstdio>
+
+#include "CppEmitter.h"
+#include "Opcodes.h"
+#include "Program.h"
+
+namespace
+{
+    const char* GetIntegerOperator(VmWord opcode)
+    {
+        switch (opcode) {
+        case Op_add_i: case Op_add_r: case Op_add_i_imm: return "+";
+        case Op_sub_i: case Op_sub_r: case Op_sub_i_imm: return "-";
+        case Op_mul_i: case Op_mul_r: case Op_mul_i_imm: return "*";
+        case Op_div_i: case Op_div_r: return "/";
+        case Op_mod_i: return "%";
+        case Op_or_i: return "|";
+        case Op_and_i: return "&";
+        default: return nullptr;
+        }
+    }
+
+    const char* GetComparison(VmWord opcode)
+    {
+        switch (opcode) {
+        case Op_eq_i: case Op_eq_r: case Op_eq_st: case Op_eq_i_imm: case Op_jeq_i: case Op_jeq_st: case Op_jeq_i_imm: return "==";
+        case Op_neq_i: case Op_neq_r: case Op_neq_st: case Op_neq_i_imm: case Op_jne_i: case Op_jne_st: case Op_jne_i_imm: return "!=";
+        case Op_lt_i: case Op_lt_r: case Op_lt_st: case Op_lt_i_imm: case Op_jlt_i: case Op_jlt_st: case Op_jlt_i_imm: return "<";
+        case Op_gt_i: case Op_gt_r: case Op_gt_st: case Op_gt_i_imm: case Op_jgt_i: case Op_jgt_st: case Op_jgt_i_imm: return ">";
+        case Op_lte_i: case Op_lte_r: case Op_lte_st: case Op_lte_i_imm: case Op_jle_i: case Op_jle_st: case Op_jle_i_imm: return "<=";
+        case Op_gte_i: case Op_gte_r: case Op_gte_st: case Op_gte_i_imm: case Op_jge_i: case Op_jge_st: case Op_jge_i_imm: return ">=";
+        default: return nullptr;
+        }
+    }
+
+    std::string FormatInteger(int64_t value)
+    {
+        // the most negative value can't be written as a negated literal
+        if (value == INT64_MIN)
+            return "INT64_MIN";
+
+        char text[32];
+        snprintf(text, sizeof(text), "INT64_C(%lld)", (long long)value);
+        return text;
+    }
+}
+
+CppEmitter::CppEmitter(const Program& program)
+    :
+    mProgram(program),
+    mOutput(),
+    mLabels(),
+    mStrings(),
+    mLocalCount(0),
+    mTemporaryCount(0)
+{
+    // intentionally left blank
+}
+
+CppEmitter::~CppEmitter()
+{
+    // intentionally left blank
+}
+
+std::string CppEmitter::run()
+{
+    mOutput.clear();
+    scan();
+
+    append("// Generated by ZetaBASIC; do not edit.\n");
+    append("#include <cmath>\n");
+    append("#include <cstdint>\n");
+    append("#include \"Runtime.h\"\n");
+    append("#include \"StdioConsole.h\"\n\n");
+    emitStrings();
+
+    append("static void program(Runtime& rt)\n{\n");
+    for (int64_t ix = 0; ix < mLocalCount; ++ix)
+        append("    int64_t l%d = 0;\n", (int)ix);
+    for (int64_t ix = 0; ix < mTemporaryCount; ++ix)
+        append("    int64_t t%d = 0;\n", (int)ix);
+
+    const VmWord* code = mProgram.getCode();
+    int codeSize = mProgram.getCodeSize();
+    for (int ix = 0; ix < codeSize; ix += getInstructionSize(code[ix])) {
+        if (mLabels[ix])
+            append("%s:\n", getLabel(ix).c_str());
+        emitInstruction(code, ix);
+    }
+    if (mLabels[codeSize])
+        append("%s:\n", getLabel(codeSize).c_str());
+    append("    return;\n}\n\n");
+
+    append("int main()\n{\n    StdioConsole console;\n    Runtime rt(console);\n    program(rt);\n    return 0;\n}\n");
+    return mOutput;
+}
+
+void CppEmitter::scan()
+{
+    const VmWord* code = mProgram.getCode();
+    int codeSize = mProgram.getCodeSize();
+
+    // one extra entry lets jumps target the end of the code
+    mLabels.assign(codeSize + 1, false);
+    mStrings.clear();
+    mLocalCount = 0;
+    mTemporaryCount = 0;
+
+    for (int ix = 0; ix < codeSize; ix += getInstructionSize(code[ix])) {
+        VmWord opcode = code[ix];
+        VmWord word = getInstructionSize(opcode) > 1 ? code[ix + 1] : 0;
+
+        if (opcode == Op_reserve) {
+            mLocalCount = (int64_t)(word & OperandSizeMask);
+            mTemporaryCount = (int64_t)((word >> Operand1Shift) & OperandSizeMask);
+        } else if (opcode == Op_load_st) {
+            int index = (int)((word >> Operand1Shift) & OperandSizeMask);
+            if (index >= (int)mStrings.size())
+                mStrings.resize(index + 1, -1);
+            mStrings[index] = index;
+        } else if (opcode == Op_jmp || opcode == Op_jmpz || opcode == Op_jmpnz) {
+            mLabels[(word >> JumpShift) & JumpSizeMask] = true;
+        } else if (opcode >= Op_jeq_i && opcode <= Op_jge_i_imm) {
+            mLabels[(word >> BranchShift) & BranchSizeMask] = true;
+        } else if (opcode == Op_for_next) {
+            mLabels[code[ix + ForNextTargetWord]] = true;
+        }
+    }
+}
+
+void CppEmitter::emitStrings()
+{
+    for (int index : mStrings) {
+        if (index < 0)
+            continue;
+
+        // octal escapes can't run into the characters that follow them
+        auto& string = mProgram.getString(index);
+        append("static const char kString%d[] = \"", index);
+        for (int ix = 0; ix < string.getLength(); ++ix) {
+            unsigned char ch = (unsigned char)string.getText()[ix];
+            if (ch < 0x20 || ch >= 0x7f || ch == '"' || ch == '\\' || ch == '?')
+                append("\\%03o", ch);
+            else
+                append("%c", ch);
+        }
+        append("\";\n");
+    }
+    if (!mStrings.empty())
+        append("\n");
+}
+
+void CppEmitter::emitInstruction(const VmWord* code, int ix)
+{
+    VmWord opcode = code[ix];
+    VmWord word = getInstructionSize(opcode) > 1 ? code[ix + 1] : 0;
+
+    std::string a = getOperand(word, Operand0Shift);
+    std::string b = getOperand(word, Operand1Shift);
+    std::string c = getOperand(word, Operand2Shift);
+    const char* op = GetIntegerOperator(opcode);
+    const char* compare = GetComparison(opcode);
+
+    switch (opcode) {
+    case Op_nop:
+    case Op_reserve:
+        break;
+
+    case Op_end:
+        append("    return;\n");
+        break;
+
+    case Op_free_mem:
+        append("    rt.freeMem(%s);\n", a.c_str());
+        break;
+
+    case Op_new_type:
+        append("    %s = rt.newType(%d);\n", a.c_str(), (int)((word >> MemShift) & MemSizeMask));
+        break;
+
+    case Op_read_type:
+        append("    %s = rt.readType(%s, %d);\n", a.c_str(), b.c_str(), (int)((word >> MemShift) & MemSizeMask));
+        break;
+
+    case Op_write_type:
+        append("    rt.writeType(%s, %s, %d);\n", a.c_str(), b.c_str(), (int)((word >> MemShift) & MemSizeMask));
+        break;
+
+    case Op_new_array:
+        append("    %s = rt.newArray(%s, %s, %d);\n", a.c_str(), b.c_str(), c.c_str(), (int)((word >> ArrayElementShift) & ArrayElementSizeMask));
+        break;
+
+    case Op_jmp:
+        append("    goto %s;\n", getLabel((word >> JumpShift) & JumpSizeMask).c_str());
+        break;
+
+    case Op_jmpz:
+    case Op_jmpnz:
+        append("    if (%s %s 0) goto %s;\n", a.c_str(), opcode == Op_jmpz ? "==" : "!=", getLabel((word >> JumpShift) & JumpSizeMask).c_str());
+        break;
+
+    case Op_load_c:
+        append("    %s = %s;\n", a.c_str(), FormatInteger(mProgram.getIntegerConstant((int)((word >> Operand1Shift) & OperandSizeMask))).c_str());
+        break;
+
+    case Op_load_st:
+    {
+        int index = (int)((word >> Operand1Shift) & OperandSizeMask);
+        append("    %s = rt.loadString(kString%d, %d);\n", a.c_str(), index, mProgram.getString(index).getLength());
+        break;
+    }
+
+    case Op_add_i:
+    case Op_sub_i:
+    case Op_mul_i:
+    case Op_div_i:
+    case Op_mod_i:
+    case Op_or_i:
+    case Op_and_i:
+        append("    %s = %s %s %s;\n", a.c_str(), b.c_str(), op, c.c_str());
+        break;
+
+    case Op_add_r:
+    case Op_sub_r:
+    case Op_mul_r:
+    case Op_div_r:
+        append("    %s = fromReal(toReal(%s) %s toReal(%s));\n", a.c_str(), b.c_str(), op, c.c_str());
+        break;
+
+    case Op_mod_r:
+        append("    %s = fromReal(fmod(toReal(%s), toReal(%s)));\n", a.c_str(), b.c_str(), c.c_str());
+        break;
+
+    case Op_add_st:
+        append("    %s = rt.addStrings(%s, %s);\n", a.c_str(), b.c_str(), c.c_str());
+        break;
+
+    case Op_eq_i:
+    case Op_neq_i:
+    case Op_lt_i:
+    case Op_gt_i:
+    case Op_lte_i:
+    case Op_gte_i:
+        append("    %s = %s %s %s ? 1 : 0;\n", a.c_str(), b.c_str(), compare, c.c_str());
+        break;
+
+    case Op_eq_r:
+    case Op_neq_r:
+    case Op_lt_r:
+    case Op_gt_r:
+    case Op_lte_r:
+    case Op_gte_r:
+        append("    %s = toReal(%s) %s toReal(%s) ? 1 : 0;\n", a.c_str(), b.c_str(), compare, c.c_str());
+        break;
+
+    case Op_eq_st:
+    case Op_neq_st:
+    case Op_lt_st:
+    case Op_gt_st:
+    case Op_lte_st:
+    case Op_gte_st:
+        append("    %s = rt.compareStrings(%s, %s) %s 0 ? 1 : 0;\n", a.c_str(), b.c_str(), c.c_str(), compare);
+        break;
+
+    case Op_neg_i:
+        append("    %s = -%s;\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_neg_r:
+        append("    %s = fromReal(-toReal(%s));\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_not_i:
+        append("    %s = ~%s;\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_i2r:
+        append("    %s = fromReal(double(%s));\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_r2i:
+        append("    %s = int64_t(toReal(%s));\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_mov:
+        append("    %s = %s;\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_print_b:
+        append("    rt.printBoolean(%s);\n", a.c_str());
+        break;
+
+    case Op_print_i:
+        append("    rt.printInteger(%s);\n", a.c_str());
+        break;
+
+    case Op_print_r:
+        append("    rt.printReal(%s);\n", a.c_str());
+        break;
+
+    case Op_print_st:
+        append("    rt.printString(%s);\n", a.c_str());
+        break;
+
+    case Op_print_nl:
+        append("    rt.printNewline();\n");
+        break;
+
+    case Op_input_i:
+        append("    %s = rt.inputInteger();\n", a.c_str());
+        break;
+
+    case Op_input_st:
+        append("    %s = rt.inputString();\n", a.c_str());
+        break;
+
+    case Op_fn_len:
+        append("    %s = rt.fnLen(%s);\n", a.c_str(), b.c_str());
+        break;
+
+    case Op_fn_left:
+        append("    %s = rt.fnLeft(%s, %s);\n", a.c_str(), b.c_str(), c.c_str());
+        break;
+
+    case Op_add_i_imm:
+    case Op_sub_i_imm:
+    case Op_mul_i_imm:
+        append("    %s = %s %s %s;\n", a.c_str(), b.c_str(), op, FormatInteger((int32_t)(word >> ImmediateShift)).c_str());
+        break;
+
+    case Op_eq_i_imm:
+    case Op_neq_i_imm:
+    case Op_lt_i_imm:
+    case Op_gt_i_imm:
+    case Op_lte_i_imm:
+    case Op_gte_i_imm:
+        append("    %s = %s %s %s ? 1 : 0;\n", a.c_str(), b.c_str(), compare, FormatInteger((int32_t)(word >> ImmediateShift)).c_str());
+        break;
+
+    case Op_mov_imm:
+        append("    %s = %s;\n", a.c_str(), FormatInteger((int32_t)(word >> ImmediateShift)).c_str());
+        break;
+
+    case Op_jeq_i:
+    case Op_jne_i:
+    case Op_jlt_i:
+    case Op_jgt_i:
+    case Op_jle_i:
+    case Op_jge_i:
+        append("    if (%s %s %s) goto %s;\n", a.c_str(), compare, b.c_str(), getLabel((word >> BranchShift) & BranchSizeMask).c_str());
+        break;
+
+    case Op_jeq_st:
+    case Op_jne_st:
+    case Op_jlt_st:
+    case Op_jgt_st:
+    case Op_jle_st:
+    case Op_jge_st:
+        append("    if (rt.compareStrings(%s, %s) %s 0) goto %s;\n", a.c_str(), b.c_str(), compare, getLabel((word >> BranchShift) & BranchSizeMask).c_str());
+        break;
+
+    case Op_jeq_i_imm:
+    case Op_jne_i_imm:
+    case Op_jlt_i_imm:
+    case Op_jgt_i_imm:
+    case Op_jle_i_imm:
+    case Op_jge_i_imm:
+        append("    if (%s %s %s) goto %s;\n", a.c_str(), compare, FormatInteger((int64_t)code[ix + 2]).c_str(), getLabel((word >> BranchShift) & BranchSizeMask).c_str());
+        break;
+
+    case Op_for_next:
+        // the loop ends instead of stepping past either end of the range
+        append("    if (%s >= 0 ? %s <= INT64_MAX - %s : %s >= INT64_MIN - %s) {\n", c.c_str(), a.c_str(), c.c_str(), a.c_str(), c.c_str());
+        append("        %s += %s;\n", a.c_str(), c.c_str());
+        append("        if (%s >= 0 ? %s <= %s : %s >= %s) goto %s;\n", c.c_str(), a.c_str(), b.c_str(), a.c_str(), b.c_str(), getLabel(code[ix + ForNextTargetWord]).c_str());
+        append("    }\n");
+        break;
+
+    default:
+        assert(!"unknown opcode");
+        break;
+    }
+}
+
+void CppEmitter::append(const char* format, ...)
+{
+    char text[512];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    assert(length >= 0 && length < (int)sizeof(text));
+    mOutput.append(text, length);
+}
+
+std::string CppEmitter::getOperand(VmWord word, int64_t shift) const
+{
+    VmWord operand = (word >> shift) & OperandSizeMask;
+
+    // names are worked out for every field up front, and only the fields that
+    // hold operands are used; those are always module-level locals or temporaries
+    char text[16];
+    snprintf(text, sizeof(text), "%c%d", (operand & 0x3) == StackLocals ? 'l' : 't', int(operand >> 2));
+    return text;
+}
+
+std::string CppEmitter::getLabel(uint64_t target) const
+{
+    char text[16];
+    snprintf(text, sizeof(text), "L_%06X", (unsigned)target);
+    return text;
+}
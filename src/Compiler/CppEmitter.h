@@ -0,0 +1,72 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "VirtualMachine.h"
+
+class Program;
+
+// Ahead-of-time back-end that turns a compiled program into a self-contained
+// C++ translation unit.  Each frame slot becomes a local variable and each
+// jump target a label, so the host compiler is free to keep values in
+// registers and optimize across statements.  The result links against the
+// small support library that `make runtime` builds from Runtime.cpp,
+// MemoryManager.cpp and StdioConsole.cpp:
+//
+//     zb emit-cpp program.bas out.cpp
+//     c++ -O2 -I src/Interpreter -I src out.cpp libzbrt.a
+class CppEmitter
+{
+public:
+    CppEmitter(const Program& program);
+    ~CppEmitter();
+
+    std::string run();
+
+private:
+    const Program& mProgram;
+    std::string mOutput;
+
+    std::vector<bool> mLabels;
+    std::vector<int> mStrings;
+    int64_t mLocalCount;
+    int64_t mTemporaryCount;
+
+    void scan();
+    void emitStrings();
+    void emitInstruction(const VmWord* code, int ix);
+
+    void append(const char* format, ...);
+    std::string getOperand(VmWord word, int64_t shift) const;
+    std::string getLabel(uint64_t target) const;
+};
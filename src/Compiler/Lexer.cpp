@@ -58,6 +58,26 @@ Lexer::~Lexer()
 }
 
 void Lexer::run()
+{
+    scan();
+
+    if (mTokens.getSize() > 0)
+        mTokens.push(mTokenPool.alloc(TokenId::EndOfLine, TokenTag::None, StringPiece(), Range()));
+    mTokens.push(mTokenPool.alloc(TokenId::EndOfSource, TokenTag::None, StringPiece(), Range()));
+
+#ifdef DUMP_INTERNALS
+    for (int ix = 0; ix < mTokens.getSize(); ++ix) {
+        auto& token = mTokens[ix];
+        printf("%04d [%02d:%02d] %s (%s) \"%s\"\n",
+               ix, token.getRange().getStartRow(), token.getRange().getStartCol(),
+               ToString(token.getId()), ToString(token.getTag()),
+               (token.getId() != TokenId::EndOfLine) ? token.getText().getText() : "");
+    }
+    printf("\n");
+#endif
+}
+
+void Lexer::scan()
 {
     mRow = mSource.getRow();
     mCol = mSource.getCol();
@@ -100,21 +120,6 @@ void Lexer::run()
             mChar = mSource.read();
         }
     }
-
-    if (mTokens.getSize() > 0)
-        mTokens.push(mTokenPool.alloc(TokenId::EndOfLine, TokenTag::None, StringPiece(), Range()));
-    mTokens.push(mTokenPool.alloc(TokenId::EndOfSource, TokenTag::None, StringPiece(), Range()));
-
-#ifdef DUMP_INTERNALS
-    for (int ix = 0; ix < mTokens.getSize(); ++ix) {
-        auto& token = mTokens[ix];
-        printf("%04d [%02d:%02d] %s (%s) \"%s\"\n",
-               ix, token.getRange().getStartRow(), token.getRange().getStartCol(),
-               ToString(token.getId()), ToString(token.getTag()),
-               (token.getId() != TokenId::EndOfLine) ? token.getText().getText() : "");
-    }
-    printf("\n");
-#endif
 }
 
 static bool isSymbolStart(char ch)
@@ -192,6 +197,7 @@ bool Lexer::runEndState()
                 { "OR", TokenTag::Key_Or },
                 { "PRINT", TokenTag::Key_Print },
                 { "REAL", TokenTag::Key_Real },
+                { "STEP", TokenTag::Key_Step },
                 { "STRING", TokenTag::Key_String },
                 { "THEN", TokenTag::Key_Then },
                 { "TO", TokenTag::Key_To },
@@ -46,6 +46,10 @@ public:
 
     void run();
 
+    // lexes the source without ending the token list, so the compiler can
+    // lex a program one line at a time
+    void scan();
+
 private:
     StringPool& mStringPool;
     TObjectPool<Token>& mTokenPool;
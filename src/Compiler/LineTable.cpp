@@ -0,0 +1,116 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cassert>
+
+#include "LineTable.h"
+
+LineTable::LineTable()
+    :
+    mEntries(),
+    mScopes()
+{
+    // intentionally left blank
+}
+
+LineTable::~LineTable()
+{
+    // intentionally left blank
+}
+
+void LineTable::reset()
+{
+    mEntries.clear();
+    mScopes.clear();
+}
+
+int LineTable::addScope(const std::string& name, int parent)
+{
+    assert(parent >= -1 && parent < (int)mScopes.size());
+    mScopes.push_back({ name, parent });
+    return (int)mScopes.size() - 1;
+}
+
+void LineTable::addLine(int offset, int row, int scope)
+{
+    assert(mEntries.empty() || offset >= mEntries.back().offset);
+    assert(scope >= -1 && scope < (int)mScopes.size());
+
+    if (!mEntries.empty()) {
+        // statements that emitted no code don't need an entry of their own
+        if (mEntries.back().offset == offset) {
+            mEntries.back().row = row;
+            mEntries.back().scope = scope;
+            return;
+        }
+        if (mEntries.back().row == row && mEntries.back().scope == scope)
+            return;
+    }
+    mEntries.push_back({ offset, row, scope });
+}
+
+int LineTable::findLine(int offset) const
+{
+    auto entry = findEntry(offset);
+    return entry ? entry->row : 0;
+}
+
+int LineTable::findScope(int offset) const
+{
+    auto entry = findEntry(offset);
+    return entry ? entry->scope : -1;
+}
+
+const std::string& LineTable::getScopeName(int scope) const
+{
+    assert(scope >= 0 && scope < (int)mScopes.size());
+    return mScopes[scope].name;
+}
+
+int LineTable::getScopeParent(int scope) const
+{
+    assert(scope >= 0 && scope < (int)mScopes.size());
+    return mScopes[scope].parent;
+}
+
+const LineTable::Entry* LineTable::findEntry(int offset) const
+{
+    // binary search for the last entry at or before the offset
+    int low = 0;
+    int high = (int)mEntries.size();
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (mEntries[mid].offset <= offset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low > 0 ? &mEntries[low - 1] : nullptr;
+}
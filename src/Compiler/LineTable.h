@@ -0,0 +1,93 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Maps bytecode offsets back to source rows.  The translator marks the start
+// of each statement's code, so an offset belongs to the last mark at or before
+// it.
+//
+// Each mark also records the scope the statement sits in.  Scopes form a tree:
+// the roots are the module-level sections started by each label (plus one for
+// the code before the first label), and FOR loops nest inside them.
+class LineTable
+{
+public:
+    struct Entry
+    {
+        int offset;
+        int row;
+        int scope;
+    };
+
+    LineTable();
+    ~LineTable();
+
+    void reset();
+
+    int addScope(const std::string& name, int parent);
+    void addLine(int offset, int row, int scope = -1);
+
+    // both return the values for code before any marked statement (0 and -1)
+    int findLine(int offset) const;
+    int findScope(int offset) const;
+
+    const std::string& getScopeName(int scope) const;
+    int getScopeParent(int scope) const;
+
+    int getSize() const
+    {
+        return (int)mEntries.size();
+    }
+
+    const Entry& getEntry(int index) const
+    {
+        return mEntries[index];
+    }
+
+    int getScopeCount() const
+    {
+        return (int)mScopes.size();
+    }
+
+private:
+    struct Scope
+    {
+        std::string name;
+        int parent;
+    };
+
+    std::vector<Entry> mEntries;
+    std::vector<Scope> mScopes;
+
+    const Entry* findEntry(int offset) const;
+};
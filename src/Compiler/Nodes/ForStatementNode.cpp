@@ -45,6 +45,7 @@ ForStatementNode::ForStatementNode()
     mIdentifier(),
     mStartExpression(nullptr),
     mStopExpression(nullptr),
+    mStepExpression(nullptr),
     mNextName(),
     mNameRange(),
     mStatements()
@@ -80,6 +81,14 @@ void ForStatementNode::parse(Parser& parser)
     mStopExpression = ExpressionNode::parseExpression(parser);
     if (!mStopExpression)
         parser.raiseError(CompileErrorId::SyntaxError, "Expected Expression");
+
+    if (parser.getToken().getTag() == TokenTag::Key_Step) {
+        parser.eatToken();
+
+        mStepExpression = ExpressionNode::parseExpression(parser);
+        if (!mStepExpression)
+            parser.raiseError(CompileErrorId::SyntaxError, "Expected Expression");
+    }
     parser.eatEndOfLine();
 
     auto stm = StatementNode::parseStatement(parser, StatementNode::StatementType::Module);
@@ -109,12 +118,16 @@ void ForStatementNode::analyze(Analyzer& analyzer)
 
     mStartExpression->analyze(analyzer);
     mStopExpression->analyze(analyzer);
+    if (mStepExpression)
+        mStepExpression->analyze(analyzer);
 
-    // check type of start/stop expressions
+    // check type of start/stop/step expressions
     if (mStartExpression->getType() != Type_Integer)
         throw CompileError(CompileErrorId::TypeError, mStartExpression->getRange(), "Expected Integer Expression");
     if (mStopExpression->getType() != Type_Integer)
         throw CompileError(CompileErrorId::TypeError, mStopExpression->getRange(), "Expected Integer Expression");
+    if (mStepExpression && mStepExpression->getType() != Type_Integer)
+        throw CompileError(CompileErrorId::TypeError, mStepExpression->getRange(), "Expected Integer Expression");
     if (mStartExpression->getType() != mStopExpression->getType())
         throw CompileError(CompileErrorId::TypeError, mRange, "Mismatched Start And Stop Types");
 
@@ -136,60 +149,75 @@ void ForStatementNode::translate(Translator& translator)
        pseudo-code
 
        $var = $start
-       if $var > $stop then jump [3]
+       $limit = $stop
+       $step = $step (1 if not given)
+       if $step < 0 then jump [2]
+       if $var > $limit then jump [3]
        jump [1]
     [2]
-       $var = $var + 1
+       if $var < $limit then jump [3]
     [1]
        <inner-statements>
-       if $var != $stop then jump [2]
+       $var = $var + $step
+       if $var <= $limit (>= for a negative step) then jump [1]
     [3]
+
+       the limit and step are evaluated once, and the last two lines are a
+       single for_next instruction, which also ends the loop if the add would
+       overflow
     */
+    auto counter = ResultIndex(ResultIndexType::Local, mIdentifier.getSymbol()->getLocation());
+    auto limit = translator.allocLocal();
+    auto step = translator.allocLocal();
 
     // assign start first
     mStartExpression->translate(translator);
     translator.assign(mIdentifier.getSymbol(), mStartExpression->getResultIndex());
     translator.clearTemporaries();
 
+    mStopExpression->translate(translator);
+    translator.move(limit, mStopExpression->getResultIndex());
+    translator.clearTemporaries();
+
+    if (mStepExpression) {
+        mStepExpression->translate(translator);
+        translator.move(step, mStepExpression->getResultIndex());
+    } else {
+        translator.move(step, translator.loadConstant(1));
+    }
+    translator.clearTemporaries();
+
     Label jump1 = translator.generateLabel();
     Label jump2 = translator.generateLabel();
     Label jump3 = translator.generateLabel();
 
-    // do initial check if loop should be skipped
-    mStopExpression->translate(translator);
-    auto result = translator.binaryOperator(BinaryExpressionNode::Operator::Greater,
-                                            Type_Integer,
-                                            ResultIndex(ResultIndexType::Local, mIdentifier.getSymbol()->getLocation()),
-                                            mStopExpression->getResultIndex());
+    // skip the loop if the start is already past the limit, going the way
+    // the step goes
+    auto result = translator.binaryOperator(BinaryExpressionNode::Operator::Less, Type_Integer, step, translator.loadConstant(0));
+    translator.jumpNotZero(jump2, result);
+    translator.clearTemporaries();
+    result = translator.binaryOperator(BinaryExpressionNode::Operator::Greater, Type_Integer, counter, limit);
     translator.jumpNotZero(jump3, result);
-
+    translator.clearTemporaries();
     translator.jump(jump1);
     translator.placeLabel(jump2);
+    result = translator.binaryOperator(BinaryExpressionNode::Operator::Less, Type_Integer, counter, limit);
+    translator.jumpNotZero(jump3, result);
     translator.clearTemporaries();
-
-    // perform increment of counter
-    result = translator.loadConstant(1);
-    result = translator.binaryOperator(BinaryExpressionNode::Operator::Addition,
-                                       Type_Integer,
-                                       ResultIndex(ResultIndexType::Local, mIdentifier.getSymbol()->getLocation()),
-                                       result);
-    translator.assign(mIdentifier.getSymbol(), result);
-
     translator.placeLabel(jump1);
-    translator.clearTemporaries();
 
     // execute loop statements
-    for (auto& stm : mStatements)
+    translator.enterLoop(mIdentifier.getSymbol()->getName(), mRange.getStartRow());
+    for (auto& stm : mStatements) {
+        translator.markLine(stm.getRange().getStartRow());
         stm.translate(translator);
+    }
 
-    // perform exit check
-    mStopExpression->translate(translator);
-    result = translator.binaryOperator(BinaryExpressionNode::Operator::Equals,
-                                       Type_Integer,
-                                       ResultIndex(ResultIndexType::Local, mIdentifier.getSymbol()->getLocation()),
-                                       mStopExpression->getResultIndex());
-    translator.jumpZero(jump2, result);
-
-    translator.placeLabel(jump3);
+    // step the counter and loop while it hasn't passed the limit; this is the
+    // NEXT line as far as the source is concerned
+    translator.markLine(mNameRange.getStartRow());
+    translator.forNext(jump1, counter, limit, step);
     translator.clearTemporaries();
+    translator.leaveLoop();
+    translator.placeLabel(jump3);
 }
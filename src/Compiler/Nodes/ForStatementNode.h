@@ -54,6 +54,7 @@ private:
     IdentifierNode mIdentifier;
     ExpressionNode* mStartExpression;
     ExpressionNode* mStopExpression;
+    ExpressionNode* mStepExpression;
     StringPiece mNextName;
     Range mNameRange;
     TNodeList<StatementNode> mStatements;
@@ -75,8 +75,10 @@ void ModuleNode::translate(Translator& translator)
 {
     translator.startCodeBody();
 
-    for (auto& stm : mStatements)
+    for (auto& stm : mStatements) {
+        translator.markLine(stm.getRange().getStartRow());
         stm.translate(translator);
+    }
 
     translator.endCodeBody();
 }
@@ -34,7 +34,8 @@
 StringTable::StringTable(StringPool& stringPool)
     :
     mStringPool(stringPool),
-    mStrings()
+    mStrings(),
+    mIndices()
 {
     // intentionally left blank
 }
@@ -47,16 +48,23 @@ StringTable::~StringTable()
 void StringTable::reset()
 {
     mStrings.clear();
+    mIndices.clear();
 }
 
 int StringTable::addString(const StringPiece& string)
 {
-    auto len = (int)mStrings.size();
-    for (auto ix = 0; ix < len; ++ix)
-        if (mStrings[ix].exactCompareWithCase(string))
-            return ix;
+    auto entry = mIndices.emplace(std::string(string.getText(), string.getLength()), (int)mStrings.size());
+    if (!entry.second)
+        return entry.first->second;
     mStrings.push_back(mStringPool.alloc(string.getText(), string.getLength()));        // ensure null-terminated string is pushed
-    return len;
+    return entry.first->second;
+}
+
+int StringTable::attachString(const StringPiece& string)
+{
+    assert(string.getText()[string.getLength()] == 0);
+    mStrings.push_back(string);
+    return (int)mStrings.size() - 1;
 }
 
 const StringPiece& StringTable::getString(int index) const
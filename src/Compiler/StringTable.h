@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include "StringPiece.h"
 
@@ -45,11 +47,21 @@ public:
 
     int addString(const StringPiece& string);
 
+    // adds a null-terminated string that outlives the table, such as one in a
+    // mapped program image, without copying it or looking for a duplicate
+    int attachString(const StringPiece& string);
+
     const StringPiece& getString(int index) const;
 
+    int getSize() const
+    {
+        return (int)mStrings.size();
+    }
+
     void dump() const;
 
 private:
     StringPool& mStringPool;
     std::vector<StringPiece> mStrings;
+    std::unordered_map<std::string, int> mIndices;
 };
@@ -33,9 +33,9 @@
 
 #include "TextSourceStream.h"
 
-TextSourceStream::TextSourceStream(const char* text, int length)
+TextSourceStream::TextSourceStream(const char* text, int length, int row)
     :
-    mRow(1),
+    mRow(row),
     mCol(1),
     mLength(length),
     mPosition(0),
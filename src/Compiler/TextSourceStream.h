@@ -37,7 +37,7 @@ class TextSourceStream
     public ISourceStream
 {
 public:
-    TextSourceStream(const char* text, int length = -1);
+    TextSourceStream(const char* text, int length = -1, int row = 1);
     virtual ~TextSourceStream();
 
     virtual int getRow() const;
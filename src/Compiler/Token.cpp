@@ -62,6 +62,7 @@ const char* ToString(TokenTag tag)
     case TokenTag::Key_Next: return "NEXT";
     case TokenTag::Key_Or: return "OR";
     case TokenTag::Key_Print: return "PRINT";
+    case TokenTag::Key_Step: return "STEP";
     case TokenTag::Key_Then: return "THEN";
     case TokenTag::Key_To: return "TO";
     case TokenTag::Sym_Add: return "+";
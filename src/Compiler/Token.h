@@ -70,6 +70,7 @@ enum class TokenTag
     Key_Or,
     Key_Print,
     Key_Real,
+    Key_Step,
     Key_String,
     Key_Then,
     Key_To,
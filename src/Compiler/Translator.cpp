@@ -28,8 +28,11 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <string>
+
 #include "ConstantTable.h"
 #include "ExpressionNode.h"
+#include "LineTable.h"
 #include "Opcodes.h"
 #include "StringTable.h"
 #include "Symbol.h"
@@ -56,6 +59,78 @@ inline VmWord Make2Args(const ResultIndex& target, const ResultIndex& arg1)
     return operand0 | (operand1 << Operand1Shift);
 }
 
+inline VmWord MakeImmediate(int64_t value)
+{
+    assert(value >= MinImmediateValue && value <= MaxImmediateValue);
+    return (VmWord)(uint32_t)(int32_t)value << ImmediateShift;
+}
+
+// returns the immediate form of an integer operator, or 0 if there isn't one;
+// when swapped, the constant is the left-hand side of the operator
+inline VmWord GetImmediateOpcode(BinaryExpressionNode::Operator op, bool swapped)
+{
+    switch (op) {
+    case BinaryExpressionNode::Operator::Addition:
+        return Op_add_i_imm;
+    case BinaryExpressionNode::Operator::Subtraction:
+        return swapped ? 0 : Op_sub_i_imm;
+    case BinaryExpressionNode::Operator::Multiplication:
+        return Op_mul_i_imm;
+    case BinaryExpressionNode::Operator::Equals:
+        return Op_eq_i_imm;
+    case BinaryExpressionNode::Operator::NotEquals:
+        return Op_neq_i_imm;
+    case BinaryExpressionNode::Operator::Less:
+        return swapped ? Op_gt_i_imm : Op_lt_i_imm;
+    case BinaryExpressionNode::Operator::Greater:
+        return swapped ? Op_lt_i_imm : Op_gt_i_imm;
+    case BinaryExpressionNode::Operator::LessEquals:
+        return swapped ? Op_gte_i_imm : Op_lte_i_imm;
+    case BinaryExpressionNode::Operator::GreaterEquals:
+        return swapped ? Op_lte_i_imm : Op_gte_i_imm;
+    default:
+        return 0;
+    }
+}
+
+// returns the fused branch that jumps when a comparison has the given result,
+// or 0 if the comparison can't be fused; real comparisons are left alone since
+// inverting them would change how NaN is handled
+inline VmWord GetFusedBranchOpcode(VmWord opcode, bool whenTrue)
+{
+    static const struct
+    {
+        VmWord compare;
+        VmWord branchTrue;
+        VmWord branchFalse;
+    } fusedBranches[] = {
+        { Op_eq_i, Op_jeq_i, Op_jne_i },
+        { Op_neq_i, Op_jne_i, Op_jeq_i },
+        { Op_lt_i, Op_jlt_i, Op_jge_i },
+        { Op_gt_i, Op_jgt_i, Op_jle_i },
+        { Op_lte_i, Op_jle_i, Op_jgt_i },
+        { Op_gte_i, Op_jge_i, Op_jlt_i },
+        { Op_eq_st, Op_jeq_st, Op_jne_st },
+        { Op_neq_st, Op_jne_st, Op_jeq_st },
+        { Op_lt_st, Op_jlt_st, Op_jge_st },
+        { Op_gt_st, Op_jgt_st, Op_jle_st },
+        { Op_lte_st, Op_jle_st, Op_jgt_st },
+        { Op_gte_st, Op_jge_st, Op_jlt_st },
+        { Op_eq_i_imm, Op_jeq_i_imm, Op_jne_i_imm },
+        { Op_neq_i_imm, Op_jne_i_imm, Op_jeq_i_imm },
+        { Op_lt_i_imm, Op_jlt_i_imm, Op_jge_i_imm },
+        { Op_gt_i_imm, Op_jgt_i_imm, Op_jle_i_imm },
+        { Op_lte_i_imm, Op_jle_i_imm, Op_jgt_i_imm },
+        { Op_gte_i_imm, Op_jge_i_imm, Op_jlt_i_imm }
+    };
+
+    for (auto& branch : fusedBranches) {
+        if (branch.compare == opcode)
+            return whenTrue ? branch.branchTrue : branch.branchFalse;
+    }
+    return 0;
+}
+
 inline VmWord Make3Args(const ResultIndex& target, const ResultIndex& arg1, const ResultIndex& arg2)
 {
     int64_t operand0 = MakeOperand((int64_t)target.getType() - 1, target.getValue());
@@ -67,6 +142,7 @@ inline VmWord Make3Args(const ResultIndex& target, const ResultIndex& arg1, cons
 Translator::Translator(TItemBuffer<VmWord>& codeBuffer,
                        StringTable& stringTable,
                        ConstantTable& constantTable,
+                       LineTable& lineTable,
                        SymbolTable& symbolTable,
                        UserDefinedTypeTable& userDefinedTypeTable,
                        Node& root)
@@ -74,15 +150,21 @@ Translator::Translator(TItemBuffer<VmWord>& codeBuffer,
     mCodeBuffer(codeBuffer),
     mStringTable(stringTable),
     mConstantTable(constantTable),
+    mLineTable(lineTable),
     mSymbolTable(symbolTable),
     mUserDefinedTypeTable(userDefinedTypeTable),
     mRoot(root),
     mReserveIndex(-1),
+    mExtraLocals(0),
+    mLastLoadIndex(-1),
+    mLastBinaryIndex(-1),
     mNamedLabels(),
     mLabelTargets(),
     mNextTemporary(0),
     mMaxTemporaries(0),
-    mTemporaryTypes()
+    mTemporaryTypes(),
+    mScopes(),
+    mArgumentIndices()
 {
     // intentionally left blank
 }
@@ -108,6 +190,9 @@ void Translator::startCodeBody()
     code[0] = Op_reserve;
     code[1] = mSymbolTable.getSize();
 
+    // code up to the first label is in the "main" section
+    mScopes.assign(1, mLineTable.addScope("main", -1));
+
     // at this point, look through local symbols to find ones that need explicit initialization
     for (auto symbol : mSymbolTable.getSymbols()) {
         int baseType = symbol->getType() & kMaxTypes;
@@ -124,9 +209,29 @@ void Translator::startCodeBody()
     }
 }
 
+void Translator::markLine(int row)
+{
+    mLineTable.addLine(mCodeBuffer.getSize(), row, mScopes.empty() ? -1 : mScopes.back());
+}
+
+void Translator::enterLoop(const StringPiece& counter, int row)
+{
+    assert(!mScopes.empty());
+    std::string name = "FOR " + std::string(counter.getText(), counter.getLength()) + " (line " + std::to_string(row) + ")";
+    mScopes.push_back(mLineTable.addScope(name, mScopes.back()));
+}
+
+void Translator::leaveLoop()
+{
+    assert(mScopes.size() > 1);
+    mScopes.pop_back();
+}
+
 void Translator::endCodeBody()
 {
     assert(mReserveIndex != -1);
+    assert(mSymbolTable.getSize() + mExtraLocals <= MaxOperandValue);
+    mCodeBuffer[mReserveIndex + 1] += mExtraLocals;
     mCodeBuffer[mReserveIndex + 1] |= mMaxTemporaries << Operand1Shift;
 
     // clean up any locals that require it
@@ -202,7 +307,7 @@ ResultIndex Translator::loadConstant(int64_t value)
 
     ResultIndex target(ResultIndexType::Temporary, getTemporary());
 
-    auto ops = mCodeBuffer.alloc(2);
+    auto ops = mCodeBuffer.alloc(2, mLastLoadIndex);
     ops[0] = Op_load_c;
     ops[1] = Make1Arg(target) | (constantIndex << Operand1Shift);
 
@@ -260,9 +365,20 @@ ResultIndex Translator::unaryOperator(UnaryExpressionNode::Operator op, Typename
 
 ResultIndex Translator::binaryOperator(BinaryExpressionNode::Operator op, Typename type, const ResultIndex& lhs, const ResultIndex& rhs)
 {
+    if (type == Type_Integer) {
+        // fold a literal operand into the instruction if it has an immediate form
+        int64_t value = 0;
+        VmWord opcode = GetImmediateOpcode(op, false);
+        if (opcode != 0 && takeImmediate(rhs, value))
+            return binaryImmediate(opcode, lhs, value);
+        opcode = GetImmediateOpcode(op, true);
+        if (opcode != 0 && takeImmediate(lhs, value))
+            return binaryImmediate(opcode, rhs, value);
+    }
+
     ResultIndex target(ResultIndexType::Temporary, getTemporary(type == Type_String));
 
-    auto ops = mCodeBuffer.alloc(2);
+    auto ops = mCodeBuffer.alloc(2, mLastBinaryIndex);
     ops[0] = 0;
     switch (op) {
     case BinaryExpressionNode::Operator::Addition:
@@ -403,6 +519,9 @@ void Translator::jumpZero(Label label, const ResultIndex& result)
 {
     assert(label >= 0 && label < (int)mLabelTargets.size());
 
+    if (fuseBranch(label, result, false))
+        return;
+
     auto ops = mCodeBuffer.alloc(2);
     ops[0] = Op_jmpz;
     ops[1] = Make1Arg(result) | ((uint64_t)label << JumpShift);
@@ -412,11 +531,24 @@ void Translator::jumpNotZero(Label label, const ResultIndex& result)
 {
     assert(label >= 0 && label < (int)mLabelTargets.size());
 
+    if (fuseBranch(label, result, true))
+        return;
+
     auto ops = mCodeBuffer.alloc(2);
     ops[0] = Op_jmpnz;
     ops[1] = Make1Arg(result) | ((uint64_t)label << JumpShift);
 }
 
+void Translator::forNext(Label label, const ResultIndex& counter, const ResultIndex& limit, const ResultIndex& step)
+{
+    assert(label >= 0 && label < (int)mLabelTargets.size());
+
+    auto ops = mCodeBuffer.alloc(3);
+    ops[0] = Op_for_next;
+    ops[1] = Make3Args(counter, limit, step);
+    ops[2] = (uint64_t)label;
+}
+
 void Translator::assign(Symbol* symbol, const ResultIndex& result)
 {
     ResultIndex target(ResultIndexType::Local, symbol->getLocation());
@@ -425,6 +557,19 @@ void Translator::assign(Symbol* symbol, const ResultIndex& result)
     if (symbol->getType() == Type_String && result.getType() == ResultIndexType::Temporary)
         mTemporaryTypes[result.getValue()] = Type_Unknown;
 
+    move(target, result);
+}
+
+void Translator::move(const ResultIndex& target, const ResultIndex& result)
+{
+    int64_t value = 0;
+    if (takeImmediate(result, value)) {
+        auto ops = mCodeBuffer.alloc(2);
+        ops[0] = Op_mov_imm;
+        ops[1] = Make1Arg(target) | MakeImmediate(value);
+        return;
+    }
+
     auto ops = mCodeBuffer.alloc(2);
     ops[0] = Op_mov;
     ops[1] = Make2Args(target, result);
@@ -486,15 +631,13 @@ void Translator::end()
 
 ResultIndex Translator::builtInFunction(const StringPiece& name, TNodeList<ExpressionNode>& arguments)
 {
-    static std::vector<ResultIndex> indices;
-
-    indices.clear();
+    mArgumentIndices.clear();
     for (auto& arg : arguments)
-        indices.push_back(arg.getResultIndex());
+        mArgumentIndices.push_back(arg.getResultIndex());
 
     auto ops = mCodeBuffer.alloc(2);
 
-    static struct
+    static const struct
     {
         const char* name;
         VmWord opcode;
@@ -515,12 +658,12 @@ ResultIndex Translator::builtInFunction(const StringPiece& name, TNodeList<Expre
     assert(ops[0] != 0);
 
     ResultIndex target(ResultIndexType::Temporary, getTemporary(isString));
-    switch (indices.size()) {
+    switch (mArgumentIndices.size()) {
     case 1:
-        ops[1] = Make2Args(target, indices[0]);
+        ops[1] = Make2Args(target, mArgumentIndices[0]);
         break;
     case 2:
-        ops[1] = Make3Args(target, indices[0], indices[1]);
+        ops[1] = Make3Args(target, mArgumentIndices[0], mArgumentIndices[1]);
         break;
     default:
         assert(false);
@@ -533,6 +676,11 @@ ResultIndex Translator::builtInFunction(const StringPiece& name, TNodeList<Expre
 void Translator::placeLabel(const StringPiece& name)
 {
     placeLabel(getLabelByName(name));
+
+    // a label at module level starts a new section; inside a loop it's just
+    // another line of the loop
+    if (mScopes.size() == 1)
+        mScopes[0] = mLineTable.addScope(std::string(name.getText(), name.getLength()), -1);
 }
 
 void Translator::placeLabel(Label label)
@@ -540,6 +688,16 @@ void Translator::placeLabel(Label label)
     assert(label >= 0 && label < (int)mLabelTargets.size());
     assert(mLabelTargets[label] == -1);
     mLabelTargets[label] = mCodeBuffer.getSize();
+
+    // code before a label can't be folded into code after it
+    mLastLoadIndex = -1;
+    mLastBinaryIndex = -1;
+}
+
+ResultIndex Translator::allocLocal()
+{
+    // hidden locals sit after the ones belonging to symbols
+    return ResultIndex(ResultIndexType::Local, mSymbolTable.getSize() + mExtraLocals++);
 }
 
 Label Translator::generateLabel()
@@ -561,6 +719,8 @@ void Translator::clearTemporaries()
     }
     mTemporaryTypes.clear();
     mNextTemporary = 0;
+    mLastLoadIndex = -1;
+    mLastBinaryIndex = -1;
 }
 
 void Translator::fixupLabels()
@@ -575,6 +735,17 @@ void Translator::fixupLabels()
             word &= ~(JumpSizeMask << JumpShift);
             word |= ((uint64_t)mLabelTargets[label] << JumpShift);
             mCodeBuffer[ix + 1] = word;
+        } else if (opcode == Op_for_next) {
+            Label label = (Label)mCodeBuffer[ix + ForNextTargetWord];
+            assert(label >= 0 && label < (Label)mLabelTargets.size());
+            mCodeBuffer[ix + ForNextTargetWord] = (uint64_t)mLabelTargets[label];
+        } else if (opcode >= Op_jeq_i && opcode <= Op_jge_i_imm) {
+            VmWord word = mCodeBuffer[ix + 1];
+            Label label = (Label)((word >> BranchShift) & BranchSizeMask);
+            assert(label >= 0 && label < (Label)mLabelTargets.size());
+            word &= ~(BranchSizeMask << BranchShift);
+            word |= ((uint64_t)mLabelTargets[label] << BranchShift);
+            mCodeBuffer[ix + 1] = word;
         }
         ix += getInstructionSize(mCodeBuffer[ix]);
     }
@@ -589,6 +760,83 @@ int Translator::getTemporary(bool isString)
     return temporary;
 }
 
+bool Translator::takeImmediate(const ResultIndex& index, int64_t& value)
+{
+    // only a constant loaded by the most recent instruction can be folded
+    if (mLastLoadIndex == -1 || mLastLoadIndex + 2 != mCodeBuffer.getSize())
+        return false;
+
+    VmWord word = mCodeBuffer[mLastLoadIndex + 1];
+    int temporary = int((word & OperandSizeMask) >> 2);
+    if (index.getType() != ResultIndexType::Temporary || index.getValue() != temporary)
+        return false;
+
+    int64_t constant = mConstantTable.getIntegerConstant((int)((word >> Operand1Shift) & OperandSizeMask));
+    if (constant < MinImmediateValue || constant > MaxImmediateValue)
+        return false;
+
+    // drop the load and hand its temporary back if nothing has been allocated since
+    mCodeBuffer.trim(2);
+    mLastLoadIndex = -1;
+    if (temporary == mNextTemporary - 1) {
+        --mNextTemporary;
+        mTemporaryTypes.pop_back();
+    }
+
+    value = constant;
+    return true;
+}
+
+bool Translator::fuseBranch(Label label, const ResultIndex& result, bool whenTrue)
+{
+    // only a comparison made by the most recent instruction can be fused
+    if (mLastBinaryIndex == -1 || mLastBinaryIndex + 2 != mCodeBuffer.getSize())
+        return false;
+
+    VmWord opcode = GetFusedBranchOpcode(mCodeBuffer[mLastBinaryIndex], whenTrue);
+    if (opcode == 0)
+        return false;
+
+    VmWord word = mCodeBuffer[mLastBinaryIndex + 1];
+    int temporary = int((word & OperandSizeMask) >> 2);
+    if (result.getType() != ResultIndexType::Temporary || result.getValue() != temporary)
+        return false;
+
+    // drop the comparison and hand its temporary back; the branch reads the
+    // comparison's arguments directly
+    mCodeBuffer.trim(2);
+    mLastBinaryIndex = -1;
+    if (temporary == mNextTemporary - 1) {
+        --mNextTemporary;
+        mTemporaryTypes.pop_back();
+    }
+
+    VmWord args = (word >> Operand1Shift) & OperandSizeMask;
+    if (opcode >= Op_jeq_i_imm && opcode <= Op_jge_i_imm) {
+        auto ops = mCodeBuffer.alloc(3);
+        ops[0] = opcode;
+        ops[1] = args | ((uint64_t)label << BranchShift);
+        ops[2] = (VmWord)(int64_t)(int32_t)(word >> ImmediateShift);
+    } else {
+        args |= ((word >> Operand2Shift) & OperandSizeMask) << Operand1Shift;
+        auto ops = mCodeBuffer.alloc(2);
+        ops[0] = opcode;
+        ops[1] = args | ((uint64_t)label << BranchShift);
+    }
+    return true;
+}
+
+ResultIndex Translator::binaryImmediate(VmWord opcode, const ResultIndex& lhs, int64_t value)
+{
+    ResultIndex target(ResultIndexType::Temporary, getTemporary());
+
+    auto ops = mCodeBuffer.alloc(2, mLastBinaryIndex);
+    ops[0] = opcode;
+    ops[1] = Make2Args(target, lhs) | MakeImmediate(value);
+
+    return target;
+}
+
 Label Translator::getLabelByName(const StringPiece& name)
 {
     std::string labelName = std::string(name.getText(), name.getLength());
@@ -638,7 +886,12 @@ void Translator::dumpCode()
         Args1,
         NewType,
         TypeAccess,
-        NewArray
+        NewArray,
+        Args2Imm,
+        Args1Imm,
+        Branch2,
+        Branch1Imm,
+        ForNext
     };
     static struct Instruction
     {
@@ -703,7 +956,36 @@ void Translator::dumpCode()
         { "input_i", InstructionType::Args1 },
         { "input_st", InstructionType::Args1 },
         { "fn_len", InstructionType::Args2 },
-        { "fn_left", InstructionType::Args3 }
+        { "fn_left", InstructionType::Args3 },
+        { "add_i_imm", InstructionType::Args2Imm },
+        { "sub_i_imm", InstructionType::Args2Imm },
+        { "mul_i_imm", InstructionType::Args2Imm },
+        { "eq_i_imm", InstructionType::Args2Imm },
+        { "neq_i_imm", InstructionType::Args2Imm },
+        { "lt_i_imm", InstructionType::Args2Imm },
+        { "gt_i_imm", InstructionType::Args2Imm },
+        { "lte_i_imm", InstructionType::Args2Imm },
+        { "gte_i_imm", InstructionType::Args2Imm },
+        { "mov_imm", InstructionType::Args1Imm },
+        { "jeq_i", InstructionType::Branch2 },
+        { "jne_i", InstructionType::Branch2 },
+        { "jlt_i", InstructionType::Branch2 },
+        { "jgt_i", InstructionType::Branch2 },
+        { "jle_i", InstructionType::Branch2 },
+        { "jge_i", InstructionType::Branch2 },
+        { "jeq_st", InstructionType::Branch2 },
+        { "jne_st", InstructionType::Branch2 },
+        { "jlt_st", InstructionType::Branch2 },
+        { "jgt_st", InstructionType::Branch2 },
+        { "jle_st", InstructionType::Branch2 },
+        { "jge_st", InstructionType::Branch2 },
+        { "jeq_i_imm", InstructionType::Branch1Imm },
+        { "jne_i_imm", InstructionType::Branch1Imm },
+        { "jlt_i_imm", InstructionType::Branch1Imm },
+        { "jgt_i_imm", InstructionType::Branch1Imm },
+        { "jle_i_imm", InstructionType::Branch1Imm },
+        { "jge_i_imm", InstructionType::Branch1Imm },
+        { "for_next", InstructionType::ForNext }
     };
     static const char* names[] = { "local", "temporary", "parameter", "global" };
 
@@ -779,6 +1061,45 @@ void Translator::dumpCode()
                    ((mCodeBuffer[ix + 1] >> Operand2Shift) & OperandSizeMask) >> 2,
                    ((mCodeBuffer[ix + 1] >> ArrayElementShift) & ArrayElementSizeMask));
             break;
+        case InstructionType::Args2Imm:
+            printf("[%s] #%lld, [%s] #%lld, %d\n",
+                   names[mCodeBuffer[ix + 1] & 0x3],
+                   (long long)((mCodeBuffer[ix + 1] & OperandSizeMask) >> 2),
+                   names[(mCodeBuffer[ix + 1] >> Operand1Shift) & 0x3],
+                   (long long)(((mCodeBuffer[ix + 1] >> Operand1Shift) & OperandSizeMask) >> 2),
+                   (int32_t)(mCodeBuffer[ix + 1] >> ImmediateShift));
+            break;
+        case InstructionType::Args1Imm:
+            printf("[%s] #%lld, %d\n",
+                   names[mCodeBuffer[ix + 1] & 0x3],
+                   (long long)((mCodeBuffer[ix + 1] & OperandSizeMask) >> 2),
+                   (int32_t)(mCodeBuffer[ix + 1] >> ImmediateShift));
+            break;
+        case InstructionType::Branch2:
+            printf("[%s] #%lld, [%s] #%lld, [%06llX]\n",
+                   names[mCodeBuffer[ix + 1] & 0x3],
+                   (long long)((mCodeBuffer[ix + 1] & OperandSizeMask) >> 2),
+                   names[(mCodeBuffer[ix + 1] >> Operand1Shift) & 0x3],
+                   (long long)(((mCodeBuffer[ix + 1] >> Operand1Shift) & OperandSizeMask) >> 2),
+                   (unsigned long long)(mCodeBuffer[ix + 1] >> BranchShift));
+            break;
+        case InstructionType::Branch1Imm:
+            printf("[%s] #%lld, %lld, [%06llX]\n",
+                   names[mCodeBuffer[ix + 1] & 0x3],
+                   (long long)((mCodeBuffer[ix + 1] & OperandSizeMask) >> 2),
+                   (long long)mCodeBuffer[ix + 2],
+                   (unsigned long long)(mCodeBuffer[ix + 1] >> BranchShift));
+            break;
+        case InstructionType::ForNext:
+            printf("[%s] #%lld, [%s] #%lld, [%s] #%lld, [%06llX]\n",
+                   names[mCodeBuffer[ix + 1] & 0x3],
+                   (long long)((mCodeBuffer[ix + 1] & OperandSizeMask) >> 2),
+                   names[(mCodeBuffer[ix + 1] >> Operand1Shift) & 0x3],
+                   (long long)(((mCodeBuffer[ix + 1] >> Operand1Shift) & OperandSizeMask) >> 2),
+                   names[(mCodeBuffer[ix + 1] >> Operand2Shift) & 0x3],
+                   (long long)(((mCodeBuffer[ix + 1] >> Operand2Shift) & OperandSizeMask) >> 2),
+                   (unsigned long long)mCodeBuffer[ix + ForNextTargetWord]);
+            break;
         default:
             assert(false);
             break;
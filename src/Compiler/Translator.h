@@ -48,6 +48,7 @@ typedef int Label;
 
 class ConstantTable;
 class ExpressionNode;
+class LineTable;
 class StringTable;
 class UserDefinedTypeTable;
 struct UserDefinedType;
@@ -58,6 +59,7 @@ public:
     Translator(TItemBuffer<VmWord>& bytecode,
                StringTable& stringTable,
                ConstantTable& constantTable,
+               LineTable& lineTable,
                SymbolTable& symbolTable,
                UserDefinedTypeTable& userDefinedTypeTable,
                Node& root);
@@ -68,6 +70,13 @@ public:
     void startCodeBody();
     void endCodeBody();
 
+    // code emitted from here on belongs to the given source row
+    void markLine(int row);
+
+    // FOR loop bodies get a scope of their own in the line table
+    void enterLoop(const StringPiece& counter, int row);
+    void leaveLoop();
+
     ResultIndex readMem(const ResultIndex& source, int offset);
     void writeMem(const ResultIndex& target, const ResultIndex& value, int offset, bool isString = false);
 
@@ -85,8 +94,12 @@ public:
     void jump(Label label);
     void jumpZero(Label label, const ResultIndex& result);
     void jumpNotZero(Label label, const ResultIndex& result);
+    void forNext(Label label, const ResultIndex& counter, const ResultIndex& limit, const ResultIndex& step);
 
     void assign(Symbol* symbol, const ResultIndex& result);
+    void move(const ResultIndex& target, const ResultIndex& result);
+
+    ResultIndex allocLocal();
 
     void print(Typename type, const ResultIndex& index);
     void printNewline();
@@ -109,11 +122,15 @@ private:
     TItemBuffer<VmWord>& mCodeBuffer;
     StringTable& mStringTable;
     ConstantTable& mConstantTable;
+    LineTable& mLineTable;
     SymbolTable& mSymbolTable;
     UserDefinedTypeTable& mUserDefinedTypeTable;
     Node& mRoot;
 
     int mReserveIndex;
+    int mExtraLocals;
+    int mLastLoadIndex;
+    int mLastBinaryIndex;
 
     std::unordered_map<std::string, Label> mNamedLabels;
     std::vector<int> mLabelTargets;
@@ -122,7 +139,14 @@ private:
     int mMaxTemporaries;
     std::vector<Typename> mTemporaryTypes;
 
+    std::vector<int> mScopes;
+
+    std::vector<ResultIndex> mArgumentIndices;
+
     int getTemporary(bool isString = false);
+    bool takeImmediate(const ResultIndex& index, int64_t& value);
+    ResultIndex binaryImmediate(VmWord opcode, const ResultIndex& lhs, int64_t value);
+    bool fuseBranch(Label label, const ResultIndex& result, bool whenTrue);
     Label getLabelByName(const StringPiece& name);
     void freeUdtStrings(const ResultIndex& value, int offset, const UserDefinedType* udt);
     void dumpCode();
@@ -0,0 +1,188 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "ConsoleChannel.h"
+
+ConsoleChannel::ConsoleChannel()
+    :
+    mCommands(4096),
+    mCancelled(false),
+    mLock(),
+    mAnswered(),
+    mHasAnswer(false),
+    mAnswer(),
+    mInputText()
+{
+    // intentionally left blank
+}
+
+ConsoleChannel::~ConsoleChannel()
+{
+    // intentionally left blank
+}
+
+void ConsoleChannel::print(const char* text)
+{
+    printn(text, (int)strlen(text));
+}
+
+void ConsoleChannel::printf(const char* format, ...)
+{
+    char buf[1024];
+    va_list ap;
+
+    va_start(ap, format);
+#ifdef _WIN32
+    int len = vsprintf_s(buf, sizeof(buf), format, ap);
+#else
+    int len = vsnprintf(buf, sizeof(buf), format, ap);
+#endif
+    va_end(ap);
+
+    printn(buf, len);
+}
+
+void ConsoleChannel::printn(const char* text, int len)
+{
+    // text shorter than len is padded out with spaces, as Window does
+    int textLen = len > 0 ? (int)strnlen(text, len) : 0;
+
+    Command command;
+    command.type = CommandType::Print;
+    for (int ix = 0; ix < len; ix += command.length) {
+        command.length = (uint8_t)std::min(len - ix, (int)sizeof(command.text));
+        int copied = std::max(0, std::min(textLen - ix, (int)command.length));
+        memcpy(command.text, text + ix, copied);
+        memset(command.text + copied, ' ', command.length - copied);
+        push(command);
+    }
+}
+
+const std::string& ConsoleChannel::input(int maxLength, bool allowEscape, bool moveToNextLine)
+{
+    Command command;
+    command.type = CommandType::Input;
+    command.length = 0;
+    command.arguments[0] = (int16_t)maxLength;
+    command.arguments[1] = allowEscape;
+    command.arguments[2] = moveToNextLine;
+    push(command);
+
+    std::unique_lock<std::mutex> lock(mLock);
+    mAnswered.wait(lock, [this]() { return mHasAnswer || mCancelled; });
+    mInputText.clear();
+    if (mHasAnswer)
+        mInputText.swap(mAnswer);
+    mHasAnswer = false;
+    return mInputText;
+}
+
+void ConsoleChannel::locate(int row, int col)
+{
+    Command command;
+    command.type = CommandType::Locate;
+    command.length = 0;
+    command.arguments[0] = (int16_t)row;
+    command.arguments[1] = (int16_t)col;
+    push(command);
+}
+
+void ConsoleChannel::color(int fg, int bg)
+{
+    Command command;
+    command.type = CommandType::Color;
+    command.length = 0;
+    command.arguments[0] = (int16_t)fg;
+    command.arguments[1] = (int16_t)bg;
+    push(command);
+}
+
+int ConsoleChannel::drain(IConsole& console, int maxCommands)
+{
+    int count = 0;
+    Command command;
+    while (count < maxCommands && mCommands.pop(command)) {
+        ++count;
+        switch (command.type) {
+        case CommandType::Print:
+            console.printn(command.text, command.length);
+            break;
+        case CommandType::Locate:
+            console.locate(command.arguments[0], command.arguments[1]);
+            break;
+        case CommandType::Color:
+            console.color(command.arguments[0], command.arguments[1]);
+            break;
+        case CommandType::Input:
+        {
+            // the program has stopped waiting for it
+            if (mCancelled)
+                break;
+
+            auto& text = console.input(command.arguments[0], command.arguments[1] != 0, command.arguments[2] != 0);
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                mAnswer = text;
+                mHasAnswer = true;
+            }
+            mAnswered.notify_one();
+            break;
+        }
+        }
+    }
+    return count;
+}
+
+void ConsoleChannel::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mCancelled = true;
+    }
+    mAnswered.notify_one();
+}
+
+void ConsoleChannel::push(const Command& command)
+{
+    // the other side drains at display rate, so a full ring soon has room
+    if (mCancelled)
+        return;
+    while (!mCommands.push(command)) {
+        if (mCancelled)
+            return;
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "IConsole.h"
+#include "TRingBuffer.h"
+
+// Console for a program running on its own thread.  Output is queued as
+// commands in a lock-free ring, and the thread that owns the real console
+// applies them with drain at whatever rate it draws; when the ring is full
+// the program waits for room.  INPUT goes through the ring as a request, and
+// the program waits for drain to answer it from the real console.
+class ConsoleChannel
+    :
+    public IConsole
+{
+public:
+    ConsoleChannel();
+    virtual ~ConsoleChannel();
+
+    virtual void print(const char* text);
+    virtual void printf(const char* format, ...);
+    virtual void printn(const char* text, int len);
+
+    virtual const std::string& input(int maxLength = -1, bool allowEscape = false, bool moveToNextLine = true);
+
+    virtual void locate(int row, int col);
+    virtual void color(int fg, int bg);
+
+    // Applies up to maxCommands queued commands to the console, answering
+    // INPUT from it, and returns how many there were.  Only one thread may
+    // drain.
+    int drain(IConsole& console, int maxCommands);
+
+    // Stops the program waiting on the console: from now on output is
+    // dropped and INPUT reads an empty line.
+    void cancel();
+
+private:
+    enum class CommandType : uint8_t
+    {
+        Print,
+        Locate,
+        Color,
+        Input
+    };
+
+    struct Command
+    {
+        CommandType type;
+        uint8_t length;
+        int16_t arguments[3];
+        char text[56];
+    };
+
+    TRingBuffer<Command> mCommands;
+    std::atomic<bool> mCancelled;
+
+    // guarded by mLock
+    std::mutex mLock;
+    std::condition_variable mAnswered;
+    bool mHasAnswer;
+    std::string mAnswer;
+
+    // only used by the program's thread
+    std::string mInputText;
+
+    void push(const Command& command);
+};
@@ -0,0 +1,78 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+
+#include "GlyphAtlas.h"
+
+GlyphAtlas::GlyphAtlas()
+    :
+    mPages(),
+    mRendered(),
+    mPalette()
+{
+    // intentionally left blank
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    for (auto page : mPages)
+        delete[] page;
+}
+
+void GlyphAtlas::setPalette(const Palette& palette)
+{
+    mPalette = palette;
+    for (auto& rendered : mRendered)
+        rendered.reset();
+}
+
+void GlyphAtlas::drawCells(const GlyphCell* cells, int count, uint32_t* pixels, int pitch)
+{
+    for (int ix = 0; ix < count; ++ix) {
+        const uint32_t* glyph = getGlyph(cells[ix].ch, cells[ix].color);
+        uint32_t* pixel = pixels + (ix * kGlyphWidth);
+        for (int y = 0; y < kGlyphHeight; ++y) {
+            memcpy(pixel, glyph, kGlyphWidth * sizeof(uint32_t));
+            glyph += kGlyphWidth;
+            pixel += pitch;
+        }
+    }
+}
+
+void GlyphAtlas::renderGlyph(uint8_t ch, uint8_t color)
+{
+    if (!mPages[color])
+        mPages[color] = new uint32_t[256 * kGlyphWidth * kGlyphHeight];
+
+    uint32_t* pixels = mPages[color] + (ch * kGlyphWidth * kGlyphHeight);
+    rasterizeGlyph((char)ch, mPalette[color & 0xf].getValue(), mPalette[color >> 4].getValue(), pixels, kGlyphWidth);
+    mRendered[color].set(ch);
+}
@@ -0,0 +1,75 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+
+#include "GlyphRasterizer.h"
+#include "Palette.h"
+
+// Glyphs from the 8x16 font, rasterized in palette colors the first time
+// each character is drawn in a given color pair and kept until the palette
+// changes, so drawing a character is a copy rather than a bit expansion.
+// The window draws with rasterizeCells unless built with ZB_GLYPH_ATLAS;
+// zbmicrobench times both.
+class GlyphAtlas
+{
+public:
+    static const int kGlyphWidth = 8;
+    static const int kGlyphHeight = 16;
+
+    GlyphAtlas();
+    ~GlyphAtlas();
+
+    // forgets every glyph drawn in the old colors
+    void setPalette(const Palette& palette);
+
+    // kGlyphHeight rows of kGlyphWidth pixels; color is (bg << 4) | fg
+    const uint32_t* getGlyph(char ch, uint8_t color)
+    {
+        uint8_t index = (uint8_t)ch;
+        if (!mRendered[color][index])
+            renderGlyph(index, color);
+        return mPages[color] + (index * kGlyphWidth * kGlyphHeight);
+    }
+
+    // copies count cells side by side, as rasterizeCells draws them
+    void drawCells(const GlyphCell* cells, int count, uint32_t* pixels, int pitch);
+
+private:
+    // one page of 256 glyphs per color pair, allocated on first use
+    uint32_t* mPages[256];
+    std::bitset<256> mRendered[256];
+    Palette mPalette;
+
+    void renderGlyph(uint8_t ch, uint8_t color);
+};
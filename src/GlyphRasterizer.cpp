@@ -0,0 +1,165 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "Font.h"
+#include "GlyphRasterizer.h"
+
+#if defined(__AVX2__)
+#define ZB_RASTER_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ZB_RASTER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    const int kGlyphWidth = 8;
+    const int kGlyphHeight = 16;
+    const int kMaxCells = 256;
+
+    const uint8_t* getGlyphRows(char ch)
+    {
+        return (const uint8_t*)font8x16 + ((uint8_t)ch * kGlyphHeight);
+    }
+
+    // With vectors, each scanline is bg ^ (mask & (fg ^ bg)), where the mask
+    // is all ones in the pixels whose font bit is set.
+#if defined(ZB_RASTER_AVX2)
+    typedef __m256i ColorVector;
+
+    inline ColorVector broadcastColor(uint32_t color)
+    {
+        return _mm256_set1_epi32((int)color);
+    }
+
+    inline void rasterizeScanline(uint8_t bits, ColorVector bg, ColorVector diff, uint32_t* pixels)
+    {
+        const __m256i select = _mm256_setr_epi32(0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1);
+        __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(bits), select), select);
+        _mm256_storeu_si256((__m256i*)pixels, _mm256_xor_si256(bg, _mm256_and_si256(mask, diff)));
+    }
+#elif defined(ZB_RASTER_SSE2)
+    typedef __m128i ColorVector;
+
+    inline ColorVector broadcastColor(uint32_t color)
+    {
+        return _mm_set1_epi32((int)color);
+    }
+
+    inline void rasterizeScanline(uint8_t bits, ColorVector bg, ColorVector diff, uint32_t* pixels)
+    {
+        const __m128i selectHigh = _mm_setr_epi32(0x80, 0x40, 0x20, 0x10);
+        const __m128i selectLow = _mm_setr_epi32(0x8, 0x4, 0x2, 0x1);
+        __m128i broadcast = _mm_set1_epi32(bits);
+        __m128i high = _mm_cmpeq_epi32(_mm_and_si128(broadcast, selectHigh), selectHigh);
+        __m128i low = _mm_cmpeq_epi32(_mm_and_si128(broadcast, selectLow), selectLow);
+        _mm_storeu_si128((__m128i*)pixels, _mm_xor_si128(bg, _mm_and_si128(high, diff)));
+        _mm_storeu_si128((__m128i*)(pixels + 4), _mm_xor_si128(bg, _mm_and_si128(low, diff)));
+    }
+#else
+    typedef uint32_t ColorVector;
+
+    inline ColorVector broadcastColor(uint32_t color)
+    {
+        return color;
+    }
+
+    // one pixel at a time, a table lookup is cheaper than building the mask
+    inline void rasterizeScanline(uint8_t bits, ColorVector bg, ColorVector diff, uint32_t* pixels)
+    {
+        uint32_t colors[2] = { bg, bg ^ diff };
+        pixels[0] = colors[(bits >> 7) & 1];
+        pixels[1] = colors[(bits >> 6) & 1];
+        pixels[2] = colors[(bits >> 5) & 1];
+        pixels[3] = colors[(bits >> 4) & 1];
+        pixels[4] = colors[(bits >> 3) & 1];
+        pixels[5] = colors[(bits >> 2) & 1];
+        pixels[6] = colors[(bits >> 1) & 1];
+        pixels[7] = colors[bits & 1];
+    }
+#endif
+}
+
+const char* getGlyphRasterizerPath()
+{
+#if defined(ZB_RASTER_AVX2)
+    return "avx2";
+#elif defined(ZB_RASTER_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void rasterizeGlyph(char ch, uint32_t fg, uint32_t bg, uint32_t* pixels, int pitch)
+{
+    const uint8_t* rows = getGlyphRows(ch);
+    ColorVector background = broadcastColor(bg);
+    ColorVector diff = broadcastColor(fg ^ bg);
+
+    for (int y = 0; y < kGlyphHeight; ++y) {
+        rasterizeScanline(rows[y], background, diff, pixels);
+        pixels += pitch;
+    }
+}
+
+void rasterizeCells(const GlyphCell* cells, int count, const uint32_t* palette, uint32_t* pixels, int pitch)
+{
+    // the colors and glyph of each cell are looked up once, not per scanline
+    const uint8_t* rows[kMaxCells];
+    ColorVector backgrounds[kMaxCells];
+    ColorVector diffs[kMaxCells];
+
+    while (count > 0) {
+        int batch = count < kMaxCells ? count : kMaxCells;
+        for (int ix = 0; ix < batch; ++ix) {
+            uint32_t fg = palette[cells[ix].color & 0xf];
+            uint32_t bg = palette[cells[ix].color >> 4];
+            rows[ix] = getGlyphRows(cells[ix].ch);
+            backgrounds[ix] = broadcastColor(bg);
+            diffs[ix] = broadcastColor(fg ^ bg);
+        }
+
+        uint32_t* scanline = pixels;
+        for (int y = 0; y < kGlyphHeight; ++y) {
+            uint32_t* pixel = scanline;
+            for (int ix = 0; ix < batch; ++ix) {
+                rasterizeScanline(rows[ix][y], backgrounds[ix], diffs[ix], pixel);
+                pixel += kGlyphWidth;
+            }
+            scanline += pitch;
+        }
+
+        cells += batch;
+        pixels += batch * kGlyphWidth;
+        count -= batch;
+    }
+}
@@ -0,0 +1,56 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+
+// A character cell as the window stores it; color is (bg << 4) | fg.
+struct GlyphCell
+{
+    char ch;
+    uint8_t color;
+};
+
+// Expands glyphs from the 8x16 font into 32-bit pixels.  On x86 each
+// scanline's byte is broadcast and turned into one lane mask per pixel, which
+// picks between the background and foreground colors in a couple of vector
+// instructions; AVX2 does the 8 pixels at once, SSE2 in two halves.  Other
+// targets get the scalar loop.  The path is chosen at compile time.
+
+// "avx2", "sse2" or "scalar"
+const char* getGlyphRasterizerPath();
+
+// draws one glyph at pixels; pitch is in pixels
+void rasterizeGlyph(char ch, uint32_t fg, uint32_t bg, uint32_t* pixels, int pitch);
+
+// Draws count cells side by side, a whole scanline of them at a time, so the
+// destination is written front to back.  Colors index the 16-entry palette.
+void rasterizeCells(const GlyphCell* cells, int count, const uint32_t* palette, uint32_t* pixels, int pitch);
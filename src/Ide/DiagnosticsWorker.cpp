@@ -0,0 +1,140 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "CompileError.h"
+#include "DiagnosticsWorker.h"
+
+DiagnosticsWorker::DiagnosticsWorker(Delegate& delegate, int delayMs)
+    :
+    mDelegate(delegate),
+    mDelay(delayMs),
+    mGeneration(0),
+    mResults(16),
+    mLock(),
+    mWakeup(),
+    mPending(),
+    mHasPending(false),
+    mDue(),
+    mStopping(false),
+    mCompiler(),
+    mThread()
+{
+    mThread = std::thread(&DiagnosticsWorker::run, this);
+}
+
+DiagnosticsWorker::~DiagnosticsWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mStopping = true;
+    }
+    mWakeup.notify_one();
+    mThread.join();
+}
+
+void DiagnosticsWorker::check(const std::vector<StringPiece>& lines)
+{
+    // copy before taking the lock, so the worker is never kept waiting on it
+    std::vector<std::string> snapshot;
+    snapshot.reserve(lines.size());
+    for (auto& line : lines)
+        snapshot.push_back(std::string(line.getText(), line.getLength()));
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mPending.swap(snapshot);
+        mHasPending = true;
+        mDue = Clock::now() + mDelay;
+        ++mGeneration;
+    }
+    mWakeup.notify_one();
+}
+
+bool DiagnosticsWorker::getDiagnostic(Diagnostic& diagnostic)
+{
+    bool found = false;
+    Diagnostic result;
+    while (mResults.pop(result)) {
+        if (result.generation == mGeneration) {
+            diagnostic = result;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void DiagnosticsWorker::run()
+{
+    std::vector<std::string> lines;
+    std::unique_lock<std::mutex> lock(mLock);
+    while (!mStopping) {
+        if (!mHasPending) {
+            mWakeup.wait(lock);
+        } else if (Clock::now() < mDue) {
+            // more edits before this expires push it back again
+            mWakeup.wait_until(lock, mDue);
+        } else {
+            lines.swap(mPending);
+            mHasPending = false;
+            unsigned generation = mGeneration;
+
+            lock.unlock();
+            compile(lines, generation);
+            lock.lock();
+        }
+    }
+}
+
+void DiagnosticsWorker::compile(const std::vector<std::string>& lines, unsigned generation)
+{
+    std::vector<StringPiece> pieces;
+    pieces.reserve(lines.size());
+    for (auto& line : lines)
+        pieces.push_back(StringPiece(line.data(), (int)line.length()));
+
+    Diagnostic diagnostic;
+    diagnostic.generation = generation;
+    diagnostic.hasError = false;
+    try {
+        (void)mCompiler.run(pieces);
+    }
+    catch (const CompileError& error) {
+        diagnostic.hasError = true;
+        diagnostic.range = error.getRange();
+        diagnostic.message = error.what();
+    }
+
+    // superseded while compiling, so a newer result is on its way
+    if (generation != mGeneration)
+        return;
+
+    if (mResults.push(diagnostic))
+        mDelegate.onDiagnosticReady();
+}
@@ -0,0 +1,103 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Compiler.h"
+#include "Range.h"
+#include "StringPiece.h"
+#include "TRingBuffer.h"
+
+struct Diagnostic
+{
+    unsigned generation;
+    bool hasError;
+    Range range;
+    std::string message;
+};
+
+// Compiles the program in the background while it is being edited, so compile
+// errors show up without running it.  Each check() replaces the snapshot
+// waiting to be compiled and restarts the delay, so a burst of keystrokes is
+// compiled once after it ends.  Results go back through a lock-free queue, and
+// the delegate is told from the worker thread when one is ready; results for
+// a snapshot that was superseded while it compiled are dropped.
+class DiagnosticsWorker
+{
+public:
+    class Delegate
+    {
+    public:
+        // called on the worker thread
+        virtual void onDiagnosticReady() = 0;
+    };
+
+    DiagnosticsWorker(Delegate& delegate, int delayMs = 250);
+    ~DiagnosticsWorker();
+
+    // copies the lines, so they need only be valid for the call
+    void check(const std::vector<StringPiece>& lines);
+
+    // returns false unless there's a result for the latest snapshot that
+    // hasn't been returned yet
+    bool getDiagnostic(Diagnostic& diagnostic);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    Delegate& mDelegate;
+    std::chrono::milliseconds mDelay;
+    std::atomic<unsigned> mGeneration;
+    TRingBuffer<Diagnostic> mResults;
+
+    // guarded by mLock
+    std::mutex mLock;
+    std::condition_variable mWakeup;
+    std::vector<std::string> mPending;
+    bool mHasPending;
+    Clock::time_point mDue;
+    bool mStopping;
+
+    // only used on the worker thread
+    Compiler mCompiler;
+
+    std::thread mThread;
+
+    void run();
+    void compile(const std::vector<std::string>& lines, unsigned generation);
+};
@@ -180,6 +180,19 @@ void EditBuffer::getContents(std::string& contents)
     }
 }
 
+// the lines point into the buffer, so they are valid until it is next edited
+void EditBuffer::getLines(std::vector<StringPiece>& lines)
+{
+    lines.clear();
+    lines.reserve(mLineCount);
+
+    EditLine* line = mFirstLine;
+    while (line) {
+        lines.push_back(StringPiece(line->text, line->len));
+        line = line->next;
+    }
+}
+
 EditLine* EditBuffer::insertBreak(EditLine* line, int col)
 {
     // first create the new line and move text as necessary
@@ -31,6 +31,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
+
+#include "StringPiece.h"
 
 struct EditLine
 {
@@ -50,6 +53,7 @@ public:
     void save(const std::string& filename);
 
     void getContents(std::string& contents);
+    void getLines(std::vector<StringPiece>& lines);
 
     EditLine* insertBreak(EditLine* line, int col);
     void insertChar(EditLine* line, int col, char ch);
@@ -75,6 +75,7 @@ void EditView::draw()
 bool EditView::handleKey(int key)
 {
     bool handled = true;
+    bool textChanged = false;
 
     int oldRow = mCurRow;
     int oldCol = mCurCol;
@@ -143,12 +144,15 @@ bool EditView::handleKey(int key)
         break;
     case ENTER:
         insertBreak();
+        textChanged = true;
         break;
     case BACKSPACE:
         backspace();
+        textChanged = true;
         break;
     case DEL:
         deleteChar();
+        textChanged = true;
         break;
     case PAGE_DOWN:
         if (mBottomLine->next) {
@@ -187,15 +191,19 @@ bool EditView::handleKey(int key)
         }
         break;
     default:
-        if (key >= 32 && key <= 126)
+        if (key >= 32 && key <= 126) {
             insertChar((char)key);
-        else
+            textChanged = true;
+        } else {
             handled = false;
+        }
         break;
     }
 
     if ((mCurRow != oldRow || mCurCol != oldCol) && mDelegate)
         mDelegate->onCursorChanged(mCurRow, mCurCol);
+    if (textChanged && mDelegate)
+        mDelegate->onTextChanged();
 
     return handled;
 }
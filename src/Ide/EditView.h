@@ -41,6 +41,7 @@ public:
     {
     public:
         virtual void onCursorChanged(int row, int col) = 0;
+        virtual void onTextChanged() = 0;
     };
 
     EditView(Window& window, EditBuffer& buffer);
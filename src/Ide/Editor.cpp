@@ -74,6 +74,7 @@ void Editor::newFile()
 
     mView->draw();
     onCursorChanged(1, 1);
+    onTextChanged();
 }
 
 void Editor::loadFile(const std::string& filename)
@@ -89,6 +90,7 @@ void Editor::loadFile(const std::string& filename)
 
     mView->draw();
     onCursorChanged(1, 1);
+    onTextChanged();
 }
 
 void Editor::saveFile(const std::string& filename)
@@ -102,6 +104,12 @@ void Editor::onCursorChanged(int row, int col)
         mDelegate->onCursorChanged(row, col);
 }
 
+void Editor::onTextChanged()
+{
+    if (mDelegate)
+        mDelegate->onTextChanged();
+}
+
 void Editor::setDelegate(Delegate* delegate)
 {
     assert(delegate);
@@ -112,3 +120,8 @@ void Editor::getCode(std::string& code)
 {
     mBuffer->getContents(code);
 }
+
+void Editor::getLines(std::vector<StringPiece>& lines)
+{
+    mBuffer->getLines(lines);
+}
@@ -31,7 +31,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "EditView.h"
+#include "StringPiece.h"
 
 class EditBuffer;
 class Window;
@@ -45,6 +47,7 @@ public:
     {
     public:
         virtual void onCursorChanged(int row, int col) = 0;
+        virtual void onTextChanged() = 0;
     };
 
     Editor(Window& window, const std::string& filename);
@@ -58,9 +61,11 @@ public:
     void saveFile(const std::string& filename);
 
     void onCursorChanged(int row, int col);
+    void onTextChanged();
     void setDelegate(Delegate* delegate);
 
     void getCode(std::string& code);
+    void getLines(std::vector<StringPiece>& lines);
 
 private:
     Window& mWindow;
@@ -28,17 +28,22 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "Ide.h"
 #include "Interpreter.h"
 #include "CompileError.h"
-#include "TextSourceStream.h"
 
 Ide::Ide(const std::string& filename)
     :
     mWindow(),
     mStatusBar(mWindow),
     mEditor(mWindow, filename),
-    mCompiler()
+    mCompiler(),
+    mLines(),
+    mDiagnostics(*this)
 {
     mEditor.setDelegate(this);
 }
@@ -59,10 +64,11 @@ void Ide::run()
     mWindow.setPalette(idePalette);
     mStatusBar.draw();
     mEditor.draw();
+    onTextChanged();
 
     int evt = 0;
     do {
-        evt = mWindow.runOnce();
+        evt = mWindow.runOnce(true);
         if (!mEditor.handleKey(evt)) {
             switch (evt) {
             case F1:
@@ -77,12 +83,16 @@ void Ide::run()
             case F4:
                 break;
             case F5:
-                runProgram();
+                if (!runProgram())
+                    evt = QUIT;
                 break;
             default:
                 break;
             }
         }
+
+        // also picks up results that came in while a program ran
+        showDiagnostic();
     } while (evt != QUIT && evt != F10);
 }
 
@@ -97,6 +107,17 @@ void Ide::onCursorChanged(int row, int col)
     mWindow.locate(oldRow, oldCol);
 }
 
+void Ide::onTextChanged()
+{
+    mEditor.getLines(mLines);
+    mDiagnostics.check(mLines);
+}
+
+void Ide::onDiagnosticReady()
+{
+    mWindow.wake();
+}
+
 const std::string& Ide::getFilename()
 {
     int row = 0, col = 0;
@@ -167,19 +188,25 @@ void Ide::saveFile()
     }
 }
 
-void Ide::runProgram()
+// returns false if the window was closed while the program ran
+bool Ide::runProgram()
 {
-    static std::string code;
-    mEditor.getCode(code);
+    mEditor.getLines(mLines);
 
     try {
-        TextSourceStream stream(code.data(), (int)code.length());
-        auto program = mCompiler.run(stream);
+        auto program = mCompiler.run(mLines);
 
-        Interpreter interpreter(mWindow, program);
+        ConsoleChannel channel;
+        Interpreter interpreter(channel, program);
         mWindow.hideCursor();
         mWindow.clear();
-        interpreter.run();
+        int stoppedBy = runInterpreter(interpreter, channel);
+        if (stoppedBy == QUIT)
+            return false;
+
+        mWindow.locate(25, 1);
+        mWindow.print(stoppedBy == BREAK ? "Break - press any key to continue" : "Press any key to continue");
+        (void)mWindow.runOnce();
         mWindow.showCursor();
 
         mStatusBar.draw();
@@ -205,4 +232,71 @@ void Ide::runProgram()
         mWindow.showCursor();
         mWindow.color(7, 1);
     }
+
+    return true;
+}
+
+// Runs the program on its own thread while this one puts its output on
+// screen, handling events in between so it can be stopped.  The program
+// checks for a stop between slices, and the screen goes up at display rate
+// however often the program draws.  Returns BREAK or QUIT if the user
+// stopped it, or 0 if it ran to the end.
+int Ide::runInterpreter(Interpreter& interpreter, ConsoleChannel& channel)
+{
+    typedef std::chrono::steady_clock Clock;
+    const int64_t sliceBudget = 16384;
+    const auto frameTime = std::chrono::milliseconds(16);
+
+    std::atomic<bool> stopping(false);
+    std::atomic<bool> finished(false);
+    std::thread worker([&]() {
+        while (interpreter.runSlice(sliceBudget) == InterpreterResult::Yielded && !stopping) {
+            // keep going
+        }
+        finished = true;
+    });
+
+    int stoppedBy = 0;
+    auto presented = Clock::now();
+    for (;;) {
+        // anything pushed before finishing is drained before leaving
+        bool done = finished;
+        int count = channel.drain(mWindow, 1024);
+        if (done && count == 0)
+            break;
+
+        int e = mWindow.poll(count == 0 ? 1 : 0);
+        if ((e == BREAK || e == QUIT) && !stoppedBy) {
+            stoppedBy = e;
+            stopping = true;
+            channel.cancel();
+        }
+
+        auto now = Clock::now();
+        if (now - presented >= frameTime) {
+            mWindow.present();
+            presented = now;
+        }
+    }
+
+    worker.join();
+    return stoppedBy;
+}
+
+void Ide::showDiagnostic()
+{
+    Diagnostic diagnostic;
+    if (!mDiagnostics.getDiagnostic(diagnostic))
+        return;
+
+    int row = 0, col = 0;
+    mWindow.getCursorLocation(row, col);
+
+    if (diagnostic.hasError)
+        mStatusBar.setError(diagnostic.range.getStartRow(), diagnostic.range.getStartCol(), diagnostic.message);
+    else
+        mStatusBar.clearError();
+
+    mWindow.color(7, 1);
+    mWindow.locate(row, col);
 }
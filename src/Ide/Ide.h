@@ -30,14 +30,21 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Compiler.h"
+#include "ConsoleChannel.h"
+#include "DiagnosticsWorker.h"
 #include "Editor.h"
+#include "Interpreter.h"
 #include "StatusBar.h"
+#include "StringPiece.h"
 #include "Window.h"
 
 class Ide
     :
-    public Editor::Delegate
+    public Editor::Delegate,
+    public DiagnosticsWorker::Delegate
 {
 public:
     Ide(const std::string& filename);
@@ -46,15 +53,21 @@ public:
     void run();
 
     void onCursorChanged(int row, int col);
+    void onTextChanged();
+    void onDiagnosticReady();
 
 private:
     Window mWindow;
     StatusBar mStatusBar;
     Editor mEditor;
     Compiler mCompiler;
+    std::vector<StringPiece> mLines;
+    DiagnosticsWorker mDiagnostics;
 
     const std::string& getFilename();
     void loadFile();
     void saveFile();
-    void runProgram();
+    bool runProgram();
+    int runInterpreter(Interpreter& interpreter, ConsoleChannel& channel);
+    void showDiagnostic();
 };
@@ -28,6 +28,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <cstdio>
+
 #include "StatusBar.h"
 #include "Window.h"
 
@@ -35,7 +37,8 @@ StatusBar::StatusBar(Window& window)
     :
     mWindow(window),
     mRow(0),
-    mCol(0)
+    mCol(0),
+    mError()
 {
     // intentionally left blank
 }
@@ -47,14 +50,37 @@ StatusBar::~StatusBar()
 
 void StatusBar::draw()
 {
-    mWindow.color(1, 3);
-    mWindow.locate(25, 1);
-    mWindow.print("  F1=New  F2=Load  F3=Save  F5=Run  F10=Quit                         ");
+    if (mError.empty()) {
+        mWindow.color(1, 3);
+        mWindow.locate(25, 1);
+        mWindow.print("  F1=New  F2=Load  F3=Save  F5=Run  F10=Quit                         ");
+    } else {
+        mWindow.color(1, 4);
+        mWindow.locate(25, 1);
+        mWindow.printn(mError.c_str(), 69);
+        mWindow.color(1, 3);
+    }
 
     mWindow.locate(25, 70);
     mWindow.printf("%06d:%03d ", mRow, mCol);
 }
 
+void StatusBar::setError(int row, int col, const std::string& message)
+{
+    char error[80];
+    snprintf(error, sizeof(error), "  [%d:%d] %s", row, col, message.c_str());
+    mError = error;
+    draw();
+}
+
+void StatusBar::clearError()
+{
+    if (!mError.empty()) {
+        mError.clear();
+        draw();
+    }
+}
+
 void StatusBar::setCursorPostion(int row, int col)
 {
     mRow = row;
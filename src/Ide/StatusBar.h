@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <string>
+
 class Window;
 
 class StatusBar
@@ -42,8 +44,13 @@ public:
 
     void setCursorPostion(int row, int col);
 
+    // shown in place of the key help until cleared
+    void setError(int row, int col, const std::string& message);
+    void clearError();
+
 private:
     Window& mWindow;
     int mRow;
     int mCol;
+    std::string mError;
 };
@@ -0,0 +1,137 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "BatchExecutor.h"
+#include "BufferConsole.h"
+#include "CompileError.h"
+#include "Compiler.h"
+#include "Interpreter.h"
+#include "SourceFile.h"
+#include "TextSourceStream.h"
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    void RunJob(Compiler& compiler, DispatchMode dispatchMode, BatchJob& job)
+    {
+        auto start = Clock::now();
+        job.output.clear();
+        job.error.clear();
+
+        std::string code;
+        if (!readSourceFile(job.filename, code)) {
+            job.error = "Failed to open file: " + job.filename;
+        } else {
+            try {
+                TextSourceStream stream(code.data(), (int)code.length());
+                auto program = compiler.run(stream);
+
+                BufferConsole console;
+                Interpreter interpreter(console, program, dispatchMode);
+                interpreter.run();
+                job.output.swap(console.getOutput());
+            }
+            catch (const CompileError& error) {
+                job.error = formatCompileError(job.filename, error);
+            }
+            catch (const std::runtime_error& error) {
+                // such as sampling two programs at once
+                job.error = job.filename + ": " + error.what();
+            }
+        }
+
+        job.elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+}
+
+BatchExecutor::BatchExecutor(int threadCount, DispatchMode dispatchMode, const std::string& cacheDirectory)
+    :
+    mThreadCount(threadCount),
+    mDispatchMode(dispatchMode),
+    mCacheDirectory(cacheDirectory),
+    mCacheStatistics()
+{
+    assert(threadCount >= 0);
+
+    if (mThreadCount == 0)
+        mThreadCount = std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+BatchExecutor::~BatchExecutor()
+{
+    // intentionally left blank
+}
+
+void BatchExecutor::run(std::vector<BatchJob>& jobs)
+{
+    std::atomic<size_t> next(0);
+    std::mutex statisticsLock;
+
+    auto work = [&](Compiler& compiler) {
+        for (size_t ix = next++; ix < jobs.size(); ix = next++)
+            RunJob(compiler, mDispatchMode, jobs[ix]);
+    };
+
+    auto worker = [&]() {
+        Compiler compiler;
+        if (mCacheDirectory.empty()) {
+            work(compiler);
+            return;
+        }
+
+        CompileCache cache(mCacheDirectory);
+        compiler.setCache(&cache);
+        work(compiler);
+
+        std::lock_guard<std::mutex> lock(statisticsLock);
+        auto& statistics = cache.getStatistics();
+        mCacheStatistics.hits += statistics.hits;
+        mCacheStatistics.misses += statistics.misses;
+        mCacheStatistics.stores += statistics.stores;
+        mCacheStatistics.evictions += statistics.evictions;
+    };
+
+    // the calling thread is one of the workers
+    int threadCount = (int)std::min((size_t)mThreadCount, jobs.size());
+    std::vector<std::thread> threads;
+    for (int ix = 1; ix < threadCount; ++ix)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+}
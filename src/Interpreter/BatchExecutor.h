@@ -0,0 +1,80 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <string>
+#include <vector>
+#include "CompileCache.h"
+#include "Instructions.h"
+
+struct BatchJob
+{
+    std::string filename;
+
+    // filled in by the run: everything the program printed, and the compile
+    // error or the reason it couldn't be read, starting with the filename
+    // (empty if it ran)
+    std::string output;
+    std::string error;
+    double elapsedMs;
+};
+
+// Runs many independent programs at once.  Each worker thread has its own
+// Compiler, and each job its own Interpreter and BufferConsole, so nothing is
+// shared between programs but the read-only handler tables; workers take the
+// next job as they finish the last, which keeps them busy when run times
+// vary.  INPUT always reads an empty line.  When given a cache directory, each
+// worker has its own CompileCache on it, and their statistics are added up.
+class BatchExecutor
+{
+public:
+    // a thread count of 0 means one per hardware thread
+    explicit BatchExecutor(int threadCount = 0, DispatchMode dispatchMode = DispatchMode::Threaded, const std::string& cacheDirectory = "");
+    ~BatchExecutor();
+
+    void run(std::vector<BatchJob>& jobs);
+
+    int getThreadCount() const
+    {
+        return mThreadCount;
+    }
+
+    // only counted with a cache directory
+    const CompileCacheStatistics& getCacheStatistics() const
+    {
+        return mCacheStatistics;
+    }
+
+private:
+    int mThreadCount;
+    DispatchMode mDispatchMode;
+    std::string mCacheDirectory;
+    CompileCacheStatistics mCacheStatistics;
+};
@@ -28,148 +28,133 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 
+#include "IConsole.h"
 #include "Instructions.h"
 #include "MemoryManager.h"
+#include "Opcodes.h"
+#include "Profiler.h"
 #include "Program.h"
 #include "Stack.h"
-#include "Window.h"
+#include "Superinstructions.h"
 
-static inline int64_t getStackValue0(ExecutionContext* context, VmWord* ip)
+static inline int64_t getStackValue0(ExecutionContext* context, const Instruction* ip)
 {
-    int stackIndex = ip[1] & 0x3;
-    int stackOffset = int((ip[1] & OperandSizeMask) >> 2);
-    return context->stacks[stackIndex].getLocal(stackOffset);
+    return context->frame[ip->operands[0]];
 }
 
-static inline int64_t getStackValue1(ExecutionContext* context, VmWord* ip)
+static inline int64_t getStackValue1(ExecutionContext* context, const Instruction* ip)
 {
-    int stackIndex = (ip[1] >> Operand1Shift) & 0x3;
-    int stackOffset = int(((ip[1] >> Operand1Shift) & OperandSizeMask) >> 2);
-    return context->stacks[stackIndex].getLocal(stackOffset);
+    return context->frame[ip->operands[1]];
 }
 
-static inline int64_t getStackValue2(ExecutionContext* context, VmWord* ip)
+static inline int64_t getStackValue2(ExecutionContext* context, const Instruction* ip)
 {
-    int stackIndex = (ip[1] >> Operand2Shift) & 0x3;
-    int stackOffset = int(((ip[1] >> Operand2Shift) & OperandSizeMask) >> 2);
-    return context->stacks[stackIndex].getLocal(stackOffset);
+    return context->frame[ip->operands[2]];
 }
 
-static inline void setStackValue0(ExecutionContext* context, VmWord* ip, int64_t value)
+static inline void setStackValue0(ExecutionContext* context, const Instruction* ip, int64_t value)
 {
-    int stackIndex = ip[1] & 0x3;
-    int stackOffset = int((ip[1] & OperandSizeMask) >> 2);
-    context->stacks[stackIndex].setLocal(stackOffset, value);
+    context->frame[ip->operands[0]] = value;
 }
 
-VmWord* ExecuteNop(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNop(ExecutionContext* context, const Instruction* ip)
 {
     // do nothing
-    return ++ip;
+    return ip + 1;
 }
 
-VmWord* ExecuteEnd(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteEnd(ExecutionContext* context, const Instruction* ip)
 {
     // return nothing, signifying end of execution
     return nullptr;
 }
 
-VmWord* ExecuteReserve(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteReserve(ExecutionContext* context, const Instruction* ip)
 {
-    context->stacks[StackLocals].reserve(ip[1] & OperandSizeMask);
-    context->stacks[StackTemporaries].reserve((ip[1] >> Operand1Shift) & OperandSizeMask);
-    return ip + 2;
+    context->stack->reserve(ip->value);
+    context->frame = context->stack->getSlot(0);
+    return ip + 1;
 }
 
-VmWord* ExecuteFreeMem(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteFreeMem(ExecutionContext* context, const Instruction* ip)
 {
     context->memoryManager->delMemory(getStackValue0(context, ip));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNewType(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNewType(ExecutionContext* context, const Instruction* ip)
 {
-    int size = (int)((ip[1] >> MemShift) & MemSizeMask);
-    setStackValue0(context, ip, context->memoryManager->newType(size));
-    return ip + 2;
+    setStackValue0(context, ip, context->memoryManager->newType((int)ip->value));
+    return ip + 1;
 }
 
-VmWord* ExecuteReadType(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteReadType(ExecutionContext* context, const Instruction* ip)
 {
-    int offset = (int)((ip[1] >> MemShift) & MemSizeMask);
-    setStackValue0(context, ip, context->memoryManager->readFromType(getStackValue1(context, ip), offset));
-    return ip + 2;
+    setStackValue0(context, ip, context->memoryManager->readFromType(getStackValue1(context, ip), (int)ip->value));
+    return ip + 1;
 }
 
-VmWord* ExecuteWriteType(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteWriteType(ExecutionContext* context, const Instruction* ip)
 {
-    int offset = (int)((ip[1] >> MemShift) & MemSizeMask);
-    context->memoryManager->writeToType(getStackValue0(context, ip), getStackValue1(context, ip), offset);
-    return ip + 2;
+    context->memoryManager->writeToType(getStackValue0(context, ip), getStackValue1(context, ip), (int)ip->value);
+    return ip + 1;
 }
 
-VmWord* ExecuteNewArray(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNewArray(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lower = getStackValue1(context, ip);
     int64_t upper = getStackValue2(context, ip);
-    int elementSize = (int)((ip[1] >> ArrayElementShift) & ArrayElementSizeMask);
-    setStackValue0(context, ip, context->memoryManager->newArray(lower, upper, elementSize));
-    return ip + 2;
+    setStackValue0(context, ip, context->memoryManager->newArray(lower, upper, (int)ip->value));
+    return ip + 1;
 }
 
-VmWord* ExecuteJmp(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteJmp(ExecutionContext* context, const Instruction* ip)
 {
-    uint64_t target = (ip[1] >> JumpShift) & JumpSizeMask;
-    assert(target < (uint64_t)context->program->getCodeSize());
-    return context->code + target;
+    return ip->target;
 }
 
-VmWord* ExecuteJmpZero(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteJmpZero(ExecutionContext* context, const Instruction* ip)
 {
-    uint64_t target = (ip[1] >> JumpShift) & JumpSizeMask;
-    assert(target < (uint64_t)context->program->getCodeSize());
-
     int64_t value = getStackValue0(context, ip);
     if (value == 0)
-        return context->code + target;
-    return ip + 2;
+        return ip->target;
+    return ip + 1;
 }
 
-VmWord* ExecuteJmpNotZero(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteJmpNotZero(ExecutionContext* context, const Instruction* ip)
 {
-    uint64_t target = (ip[1] >> JumpShift) & JumpSizeMask;
-    assert(target < (uint64_t)context->program->getCodeSize());
-
     int64_t value = getStackValue0(context, ip);
     if (value != 0)
-        return context->code + target;
-    return ip + 2;
+        return ip->target;
+    return ip + 1;
 }
 
-VmWord* ExecuteLoadConstant(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLoadConstant(ExecutionContext* context, const Instruction* ip)
 {
-    setStackValue0(context, ip, context->program->getIntegerConstant((int)((ip[1] >> Operand1Shift) & OperandSizeMask)));
-    return ip + 2;
+    setStackValue0(context, ip, ip->value);
+    return ip + 1;
 }
 
-VmWord* ExecuteLoadString(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLoadString(ExecutionContext* context, const Instruction* ip)
 {
-    auto& string = context->program->getString((int)((ip[1] >> Operand1Shift) & OperandSizeMask));
+    auto& string = context->program->getString((int)ip->value);
     setStackValue0(context, ip, context->memoryManager->newString(string.getText(), string.getLength()));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteAddIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteAddIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs + rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteAddReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteAddReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
@@ -178,26 +163,26 @@ VmWord* ExecuteAddReals(ExecutionContext* context, VmWord* ip)
     double value = lhs + rhs;
     int64_t ivalue = *(int64_t*)&value;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteAddStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteAddStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->addStrings(lhs, rhs));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteSubIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteSubIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs - rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteSubReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteSubReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
@@ -206,18 +191,18 @@ VmWord* ExecuteSubReals(ExecutionContext* context, VmWord* ip)
     double value = lhs - rhs;
     int64_t ivalue = *(int64_t*)&value;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteMulIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteMulIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs * rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteMulReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteMulReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
@@ -226,18 +211,18 @@ VmWord* ExecuteMulReals(ExecutionContext* context, VmWord* ip)
     double value = lhs * rhs;
     int64_t ivalue = *(int64_t*)&value;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteDivIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteDivIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs / rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteDivReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteDivReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
@@ -246,18 +231,18 @@ VmWord* ExecuteDivReals(ExecutionContext* context, VmWord* ip)
     double value = lhs / rhs;
     int64_t ivalue = *(int64_t*)&value;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteModIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteModIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs % rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteModReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteModReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
@@ -266,290 +251,290 @@ VmWord* ExecuteModReals(ExecutionContext* context, VmWord* ip)
     double value = fmod(lhs, rhs);
     int64_t ivalue = *(int64_t*)&value;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteEqualIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteEqualIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs == rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteEqualReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteEqualReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
     double lhs = *(double*)&ilhs;
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, lhs == rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteEqualStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteEqualStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->compareStrings(lhs, rhs) ? 0 : 1);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNotEqualIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNotEqualIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs != rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNotEqualReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNotEqualReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
     double lhs = *(double*)&ilhs;
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, lhs != rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNotEqualStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNotEqualStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->compareStrings(lhs, rhs) ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteLessIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLessIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs < rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteLessReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLessReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
     double lhs = *(double*)&ilhs;
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, lhs < rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteLessStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLessStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->compareStrings(lhs, rhs) < 0 ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteGreaterIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteGreaterIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs > rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteGreaterReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteGreaterReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
     double lhs = *(double*)&ilhs;
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, lhs > rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteGreaterStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteGreaterStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->compareStrings(lhs, rhs) > 0 ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteLessEqualsIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLessEqualsIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs <= rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteLessEqualsReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLessEqualsReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
     double lhs = *(double*)&ilhs;
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, lhs <= rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteLessEqualsStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteLessEqualsStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->compareStrings(lhs, rhs) <= 0 ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteGreaterEqualsIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteGreaterEqualsIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs >= rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteGreaterEqualsReals(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteGreaterEqualsReals(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ilhs = getStackValue1(context, ip);
     int64_t irhs = getStackValue2(context, ip);
     double lhs = *(double*)&ilhs;
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, lhs >= rhs ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteGreaterEqualsStrings(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteGreaterEqualsStrings(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, context->memoryManager->compareStrings(lhs, rhs) >= 0 ? 1 : 0);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteOrIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteOrIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs | rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteAndIntegers(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteAndIntegers(ExecutionContext* context, const Instruction* ip)
 {
     int64_t lhs = getStackValue1(context, ip);
     int64_t rhs = getStackValue2(context, ip);
     setStackValue0(context, ip, lhs & rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNegateInteger(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNegateInteger(ExecutionContext* context, const Instruction* ip)
 {
     int64_t rhs = getStackValue1(context, ip);
     setStackValue0(context, ip, -rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNegateReal(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNegateReal(ExecutionContext* context, const Instruction* ip)
 {
     int64_t irhs = getStackValue1(context, ip);
     double rhs = *(double*)&irhs;
     rhs = -rhs;
     int64_t ivalue = *(int64_t*)&rhs;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteNotInteger(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteNotInteger(ExecutionContext* context, const Instruction* ip)
 {
     int64_t rhs = getStackValue1(context, ip);
     setStackValue0(context, ip, ~rhs);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteIntegerToReal(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteIntegerToReal(ExecutionContext* context, const Instruction* ip)
 {
     int64_t rhs = getStackValue1(context, ip);
     double value = double(rhs);
     int64_t ivalue = *(int64_t*)&value;
     setStackValue0(context, ip, ivalue);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteRealToInteger(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteRealToInteger(ExecutionContext* context, const Instruction* ip)
 {
     int64_t irhs = getStackValue1(context, ip);
     double rhs = *(double*)&irhs;
     setStackValue0(context, ip, int64_t(rhs));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteMove(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteMove(ExecutionContext* context, const Instruction* ip)
 {
     setStackValue0(context, ip, getStackValue1(context, ip));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecutePrintBoolean(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecutePrintBoolean(ExecutionContext* context, const Instruction* ip)
 {
     int64_t value = getStackValue0(context, ip);
-    context->window->print(value == 1 ? "True" : "False");
-    return ip + 2;
+    context->console->print(value == 1 ? "True" : "False");
+    return ip + 1;
 }
 
-VmWord* ExecutePrintInteger(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecutePrintInteger(ExecutionContext* context, const Instruction* ip)
 {
     int64_t value = getStackValue0(context, ip);
-    context->window->printf("%lld", value);
-    return ip + 2;
+    context->console->printf("%lld", value);
+    return ip + 1;
 }
 
-VmWord* ExecutePrintReal(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecutePrintReal(ExecutionContext* context, const Instruction* ip)
 {
     int64_t ivalue = getStackValue0(context, ip);
     double value = *(double*)&ivalue;
-    context->window->printf("%f", value);
-    return ip + 2;
+    context->console->printf("%f", value);
+    return ip + 1;
 }
 
-VmWord* ExecutePrintString(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecutePrintString(ExecutionContext* context, const Instruction* ip)
 {
     int64_t value = getStackValue0(context, ip);
     const char* text = nullptr;
     int textLen = 0;
     context->memoryManager->getString(value, text, textLen);
-    context->window->printn(text, textLen);
-    return ip + 2;
+    context->console->printn(text, textLen);
+    return ip + 1;
 }
 
-VmWord* ExecutePrintNewline(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecutePrintNewline(ExecutionContext* context, const Instruction* ip)
 {
-    context->window->printn("\n", 1);
-    return ++ip;
+    context->console->printn("\n", 1);
+    return ip + 1;
 }
 
-VmWord* ExecuteInputInteger(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteInputInteger(ExecutionContext* context, const Instruction* ip)
 {
-    const std::string& text = context->window->input();
+    const std::string& text = context->console->input();
     setStackValue0(context, ip, atoll(text.c_str()));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteInputString(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteInputString(ExecutionContext* context, const Instruction* ip)
 {
-    const std::string& text = context->window->input();
+    const std::string& text = context->console->input();
     setStackValue0(context, ip, context->memoryManager->newString(text.data(), (int)text.length()));
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteFnLen(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteFnLen(ExecutionContext* context, const Instruction* ip)
 {
     const char* text = nullptr;
     int length = 0;
     context->memoryManager->getString(getStackValue1(context, ip), text, length);
     setStackValue0(context, ip, (int64_t)length);
-    return ip + 2;
+    return ip + 1;
 }
 
-VmWord* ExecuteFnLeft(ExecutionContext* context, VmWord* ip)
+static inline const Instruction* ExecuteFnLeft(ExecutionContext* context, const Instruction* ip)
 {
     const char* text = nullptr;
     int length = 0;
@@ -564,5 +549,641 @@ VmWord* ExecuteFnLeft(ExecutionContext* context, VmWord* ip)
     int64_t newString = context->memoryManager->newString(text, (int)newLength);
     setStackValue0(context, ip, newString);
 
-    return ip + 2;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteAddIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs + ip->value);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteSubIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs - ip->value);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteMulIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs * ip->value);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteEqualIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs == ip->value ? 1 : 0);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteNotEqualIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs != ip->value ? 1 : 0);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteLessIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs < ip->value ? 1 : 0);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteGreaterIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs > ip->value ? 1 : 0);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteLessEqualsIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs <= ip->value ? 1 : 0);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteGreaterEqualsIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue1(context, ip);
+    setStackValue0(context, ip, lhs >= ip->value ? 1 : 0);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteMoveImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    setStackValue0(context, ip, ip->value);
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpEqualIntegers(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) == getStackValue1(context, ip))
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpNotEqualIntegers(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) != getStackValue1(context, ip))
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpLessIntegers(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) < getStackValue1(context, ip))
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpGreaterIntegers(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) > getStackValue1(context, ip))
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpLessEqualsIntegers(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) <= getStackValue1(context, ip))
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpGreaterEqualsIntegers(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) >= getStackValue1(context, ip))
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpEqualStrings(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue0(context, ip);
+    int64_t rhs = getStackValue1(context, ip);
+    if (context->memoryManager->compareStrings(lhs, rhs) == 0)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpNotEqualStrings(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue0(context, ip);
+    int64_t rhs = getStackValue1(context, ip);
+    if (context->memoryManager->compareStrings(lhs, rhs) != 0)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpLessStrings(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue0(context, ip);
+    int64_t rhs = getStackValue1(context, ip);
+    if (context->memoryManager->compareStrings(lhs, rhs) < 0)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpGreaterStrings(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue0(context, ip);
+    int64_t rhs = getStackValue1(context, ip);
+    if (context->memoryManager->compareStrings(lhs, rhs) > 0)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpLessEqualsStrings(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue0(context, ip);
+    int64_t rhs = getStackValue1(context, ip);
+    if (context->memoryManager->compareStrings(lhs, rhs) <= 0)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpGreaterEqualsStrings(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t lhs = getStackValue0(context, ip);
+    int64_t rhs = getStackValue1(context, ip);
+    if (context->memoryManager->compareStrings(lhs, rhs) >= 0)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpEqualIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) == ip->value)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpNotEqualIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) != ip->value)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpLessIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) < ip->value)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpGreaterIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) > ip->value)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpLessEqualsIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) <= ip->value)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteJumpGreaterEqualsIntegerImmediate(ExecutionContext* context, const Instruction* ip)
+{
+    if (getStackValue0(context, ip) >= ip->value)
+        return ip->target;
+    return ip + 1;
+}
+
+static inline const Instruction* ExecuteForNext(ExecutionContext* context, const Instruction* ip)
+{
+    int64_t step = getStackValue2(context, ip);
+    int64_t counter = getStackValue0(context, ip);
+
+    // a step that would carry the counter past either end of the integer
+    // range can't land within the limit, so the loop ends there
+    if (step >= 0 ? counter > INT64_MAX - step : counter < INT64_MIN - step)
+        return ip + 1;
+    counter += step;
+    setStackValue0(context, ip, counter);
+
+    int64_t limit = getStackValue1(context, ip);
+    if (step >= 0 ? counter <= limit : counter >= limit)
+        return ip->target;
+    return ip + 1;
+}
+
+// All instructions in opcode order; each dispatch engine expands this list to
+// build its own handler table.
+#define INSTRUCTION_LIST(X) \
+    X(Nop) \
+    X(End) \
+    X(Reserve) \
+    X(FreeMem) \
+    X(NewType) \
+    X(NewArray) \
+    X(ReadType) \
+    X(WriteType) \
+    X(Jmp) \
+    X(JmpZero) \
+    X(JmpNotZero) \
+    X(LoadConstant) \
+    X(LoadString) \
+    X(AddIntegers) \
+    X(AddReals) \
+    X(AddStrings) \
+    X(SubIntegers) \
+    X(SubReals) \
+    X(MulIntegers) \
+    X(MulReals) \
+    X(DivIntegers) \
+    X(DivReals) \
+    X(ModIntegers) \
+    X(ModReals) \
+    X(EqualIntegers) \
+    X(EqualReals) \
+    X(EqualStrings) \
+    X(NotEqualIntegers) \
+    X(NotEqualReals) \
+    X(NotEqualStrings) \
+    X(LessIntegers) \
+    X(LessReals) \
+    X(LessStrings) \
+    X(GreaterIntegers) \
+    X(GreaterReals) \
+    X(GreaterStrings) \
+    X(LessEqualsIntegers) \
+    X(LessEqualsReals) \
+    X(LessEqualsStrings) \
+    X(GreaterEqualsIntegers) \
+    X(GreaterEqualsReals) \
+    X(GreaterEqualsStrings) \
+    X(OrIntegers) \
+    X(AndIntegers) \
+    X(NegateInteger) \
+    X(NegateReal) \
+    X(NotInteger) \
+    X(IntegerToReal) \
+    X(RealToInteger) \
+    X(Move) \
+    X(PrintBoolean) \
+    X(PrintInteger) \
+    X(PrintReal) \
+    X(PrintString) \
+    X(PrintNewline) \
+    X(InputInteger) \
+    X(InputString) \
+    X(FnLen) \
+    X(FnLeft) \
+    X(AddIntegerImmediate) \
+    X(SubIntegerImmediate) \
+    X(MulIntegerImmediate) \
+    X(EqualIntegerImmediate) \
+    X(NotEqualIntegerImmediate) \
+    X(LessIntegerImmediate) \
+    X(GreaterIntegerImmediate) \
+    X(LessEqualsIntegerImmediate) \
+    X(GreaterEqualsIntegerImmediate) \
+    X(MoveImmediate) \
+    X(JumpEqualIntegers) \
+    X(JumpNotEqualIntegers) \
+    X(JumpLessIntegers) \
+    X(JumpGreaterIntegers) \
+    X(JumpLessEqualsIntegers) \
+    X(JumpGreaterEqualsIntegers) \
+    X(JumpEqualStrings) \
+    X(JumpNotEqualStrings) \
+    X(JumpLessStrings) \
+    X(JumpGreaterStrings) \
+    X(JumpLessEqualsStrings) \
+    X(JumpGreaterEqualsStrings) \
+    X(JumpEqualIntegerImmediate) \
+    X(JumpNotEqualIntegerImmediate) \
+    X(JumpLessIntegerImmediate) \
+    X(JumpGreaterIntegerImmediate) \
+    X(JumpLessEqualsIntegerImmediate) \
+    X(JumpGreaterEqualsIntegerImmediate) \
+    X(ForNext)
+
+// Maps handler names back to opcodes.
+#define INSTRUCTION_INDEX(name) Index_##name,
+enum InstructionIndex
+{
+    INSTRUCTION_LIST(INSTRUCTION_INDEX)
+    Index_Count
+};
+#undef INSTRUCTION_INDEX
+
+// Superinstructions run a fixed run of instructions (see Superinstructions.h)
+// with a single dispatch.  The decoder installs them on the first record of
+// the run and leaves the records after it alone, so jumping into the middle
+// of a run still works.  If an instruction leaves the run, such as a branch
+// that's taken, the rest of it is skipped.
+#define PAIR_EXECUTOR(first, second) \
+    static inline const Instruction* Execute##first##_##second(ExecutionContext* context, const Instruction* ip) \
+    { \
+        const Instruction* next = Execute##first(context, ip); \
+        if (next != ip + 1) \
+            return next; \
+        return Execute##second(context, next); \
+    }
+#define TRIPLE_EXECUTOR(first, second, third) \
+    static inline const Instruction* Execute##first##_##second##_##third(ExecutionContext* context, const Instruction* ip) \
+    { \
+        const Instruction* next = Execute##first(context, ip); \
+        if (next != ip + 1) \
+            return next; \
+        next = Execute##second(context, next); \
+        if (next != ip + 2) \
+            return next; \
+        return Execute##third(context, next); \
+    }
+SUPERINSTRUCTION_PAIRS(PAIR_EXECUTOR)
+SUPERINSTRUCTION_TRIPLES(TRIPLE_EXECUTOR)
+#undef PAIR_EXECUTOR
+#undef TRIPLE_EXECUTOR
+
+// Every engine's handler table has the superinstructions after the last
+// opcode, pairs first and then triples.
+#define SUPERINSTRUCTION_LIST(X) \
+    SUPERINSTRUCTION_PAIRS(X##_PAIR) \
+    SUPERINSTRUCTION_TRIPLES(X##_TRIPLE)
+
+// The yield handler follows the superinstructions in the call and threaded
+// tables.
+#define COUNT_PAIR(first, second) + 1
+#define COUNT_TRIPLE(first, second, third) + 1
+enum
+{
+    Index_Yield = Index_Count SUPERINSTRUCTION_LIST(COUNT)
+};
+#undef COUNT_PAIR
+#undef COUNT_TRIPLE
+
+static const Instruction* ExecuteYield(ExecutionContext* context, const Instruction* ip)
+{
+    if (--context->budget < 0) {
+        context->resume = ip;
+        return nullptr;
+    }
+    return ((InstructionExecutor)context->yieldHandlers[ip - context->code])(context, ip);
+}
+
+void executeCalls(ExecutionContext* context, const Instruction* ip)
+{
+    do {
+        ip = ((InstructionExecutor)ip->handler)(context, ip);
+    } while (ip != nullptr);
+}
+
+uint64_t executeCounted(ExecutionContext* context, const Instruction* ip)
+{
+    uint64_t count = 0;
+    do {
+        ip = ((InstructionExecutor)ip->handler)(context, ip);
+        ++count;
+    } while (ip != nullptr);
+    return count;
+}
+
+#if defined(__GNUC__) && !defined(ZB_DISPATCH_TAIL_CALL)
+
+// Direct threading with computed goto: every handler body is expanded inline
+// and ends by jumping straight to the label stored in the next instruction.
+// Calling with a null context returns the label table instead of executing.
+static const VmWord* executeComputedGoto(ExecutionContext* context, const Instruction* ip)
+{
+#define LABEL_ADDRESS(name) (VmWord)(Index_##name == Index_End ? &&Label_Exit : &&Label_##name),
+#define LABEL_ADDRESS_PAIR(first, second) (VmWord)&&Label_##first##_##second,
+#define LABEL_ADDRESS_TRIPLE(first, second, third) (VmWord)&&Label_##first##_##second##_##third,
+    static const VmWord labels[] = {
+        INSTRUCTION_LIST(LABEL_ADDRESS)
+        SUPERINSTRUCTION_LIST(LABEL_ADDRESS)
+        (VmWord)&&Label_Yield
+    };
+#undef LABEL_ADDRESS
+#undef LABEL_ADDRESS_PAIR
+#undef LABEL_ADDRESS_TRIPLE
+
+    if (!context)
+        return labels;
+
+    // keep a private copy so the frame pointers can live in registers
+    ExecutionContext local = *context;
+
+    goto *(void*)ip->handler;
+
+#define LABEL_BODY(name) \
+    Label_##name: \
+        ip = Execute##name(&local, ip); \
+        goto *(void*)ip->handler;
+#define LABEL_BODY_PAIR(first, second) LABEL_BODY(first##_##second)
+#define LABEL_BODY_TRIPLE(first, second, third) LABEL_BODY(first##_##second##_##third)
+    INSTRUCTION_LIST(LABEL_BODY)
+    SUPERINSTRUCTION_LIST(LABEL_BODY)
+#undef LABEL_BODY
+#undef LABEL_BODY_PAIR
+#undef LABEL_BODY_TRIPLE
+
+Label_Yield:
+    if (--local.budget < 0) {
+        // hand back the frame too, so the next slice can pick up from here
+        local.resume = ip;
+        *context = local;
+        return nullptr;
+    }
+    goto *(void*)local.yieldHandlers[ip - local.code];
+
+Label_Exit:
+    return nullptr;
+}
+
+static const VmWord* getThreadedHandlers()
+{
+    static const VmWord* handlers = executeComputedGoto(nullptr, nullptr);
+    return handlers;
+}
+
+void executeThreaded(ExecutionContext* context, const Instruction* ip)
+{
+    (void)executeComputedGoto(context, ip);
+}
+
+#else
+
+// Tail-call threading: each handler runs its body and then calls the next
+// handler in tail position.  When the compiler cannot guarantee the tail call
+// is a jump, backward branches return to the trampoline below so that the
+// native stack never grows beyond one straight-line run of code.
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::musttail)
+#define ZB_MUSTTAIL [[clang::musttail]]
+#endif
+#endif
+
+typedef const Instruction*(*TailHandler)(ExecutionContext* context, const Instruction* ip);
+
+#ifdef ZB_MUSTTAIL
+#define TAIL_DISPATCH(next) ZB_MUSTTAIL return ((TailHandler)(next)->handler)(context, (next))
+#else
+#define TAIL_DISPATCH(next) \
+    if ((next) <= ip) \
+        return (next); \
+    return ((TailHandler)(next)->handler)(context, (next))
+#endif
+
+#define TAIL_HANDLER(name) \
+    static const Instruction* Tail##name(ExecutionContext* context, const Instruction* ip) \
+    { \
+        const Instruction* next = Execute##name(context, ip); \
+        TAIL_DISPATCH(next); \
+    }
+#define TAIL_HANDLER_PAIR(first, second) TAIL_HANDLER(first##_##second)
+#define TAIL_HANDLER_TRIPLE(first, second, third) TAIL_HANDLER(first##_##second##_##third)
+INSTRUCTION_LIST(TAIL_HANDLER)
+SUPERINSTRUCTION_LIST(TAIL_HANDLER)
+#undef TAIL_HANDLER
+#undef TAIL_HANDLER_PAIR
+#undef TAIL_HANDLER_TRIPLE
+
+static const Instruction* TailExit(ExecutionContext* context, const Instruction* ip)
+{
+    return nullptr;
+}
+
+static const Instruction* TailYield(ExecutionContext* context, const Instruction* ip)
+{
+    if (--context->budget < 0) {
+        context->resume = ip;
+        return nullptr;
+    }
+#ifdef ZB_MUSTTAIL
+    ZB_MUSTTAIL return ((TailHandler)context->yieldHandlers[ip - context->code])(context, ip);
+#else
+    return ((TailHandler)context->yieldHandlers[ip - context->code])(context, ip);
+#endif
+}
+
+static const VmWord* getThreadedHandlers()
+{
+#define TAIL_ADDRESS(name) (Index_##name == Index_End ? (VmWord)TailExit : (VmWord)Tail##name),
+#define TAIL_ADDRESS_PAIR(first, second) (VmWord)Tail##first##_##second,
+#define TAIL_ADDRESS_TRIPLE(first, second, third) (VmWord)Tail##first##_##second##_##third,
+    static const VmWord handlers[] = {
+        INSTRUCTION_LIST(TAIL_ADDRESS)
+        SUPERINSTRUCTION_LIST(TAIL_ADDRESS)
+        (VmWord)TailYield
+    };
+#undef TAIL_ADDRESS
+#undef TAIL_ADDRESS_PAIR
+#undef TAIL_ADDRESS_TRIPLE
+    return handlers;
+}
+
+void executeThreaded(ExecutionContext* context, const Instruction* ip)
+{
+    do {
+        ip = ((TailHandler)ip->handler)(context, ip);
+    } while (ip != nullptr);
+}
+
+#endif
+
+// Profiling handlers wrap the call handlers, reading the cycle counter on
+// either side and charging the difference to the instruction that ran.
+#define PROFILE_HANDLER(name) \
+    static const Instruction* Profile##name(ExecutionContext* context, const Instruction* ip) \
+    { \
+        uint64_t start = readCycleCounter(); \
+        const Instruction* next = Execute##name(context, ip); \
+        context->profiler->record(ip, readCycleCounter() - start); \
+        return next; \
+    }
+INSTRUCTION_LIST(PROFILE_HANDLER)
+#undef PROFILE_HANDLER
+
+const VmWord* getInstructionHandlers(DispatchMode mode)
+{
+#define EXECUTOR_ADDRESS(name) (VmWord)Execute##name,
+#define EXECUTOR_ADDRESS_PAIR(first, second) EXECUTOR_ADDRESS(first##_##second)
+#define EXECUTOR_ADDRESS_TRIPLE(first, second, third) EXECUTOR_ADDRESS(first##_##second##_##third)
+    static const VmWord executors[] = {
+        INSTRUCTION_LIST(EXECUTOR_ADDRESS)
+        SUPERINSTRUCTION_LIST(EXECUTOR_ADDRESS)
+        (VmWord)ExecuteYield
+    };
+#undef EXECUTOR_ADDRESS
+#undef EXECUTOR_ADDRESS_PAIR
+#undef EXECUTOR_ADDRESS_TRIPLE
+
+#define PROFILE_ADDRESS(name) (VmWord)Profile##name,
+    static const VmWord profilers[] = {
+        INSTRUCTION_LIST(PROFILE_ADDRESS)
+    };
+#undef PROFILE_ADDRESS
+
+    if (mode == DispatchMode::Threaded)
+        return getThreadedHandlers();
+    if (mode == DispatchMode::Profiling)
+        return profilers;
+    return executors;
+}
+
+VmWord getSuperinstructionHandler(DispatchMode mode, const VmWord* opcodes, int count, int& length)
+{
+#define SUPERINSTRUCTION_PAIR(first, second) { { Index_##first, Index_##second, 0 }, 2 },
+#define SUPERINSTRUCTION_TRIPLE(first, second, third) { { Index_##first, Index_##second, Index_##third }, 3 },
+    static const struct
+    {
+        VmWord opcodes[3];
+        int length;
+    } superinstructions[] = {
+        SUPERINSTRUCTION_LIST(SUPERINSTRUCTION)
+    };
+#undef SUPERINSTRUCTION_PAIR
+#undef SUPERINSTRUCTION_TRIPLE
+
+    // the profiling and counting modes need to see every instruction, and
+    // the JIT modes emit code per instruction
+    if (mode != DispatchMode::Call && mode != DispatchMode::Threaded)
+        return 0;
+
+    int best = -1;
+    for (int ix = 0; ix < (int)(sizeof(superinstructions) / sizeof(superinstructions[0])); ++ix) {
+        auto& superinstruction = superinstructions[ix];
+        if (superinstruction.length > count || (best != -1 && superinstruction.length <= superinstructions[best].length))
+            continue;
+        if (std::equal(opcodes, opcodes + superinstruction.length, superinstruction.opcodes))
+            best = ix;
+    }
+    if (best == -1)
+        return 0;
+
+    length = superinstructions[best].length;
+    return getInstructionHandlers(mode)[Index_Count + best];
+}
+
+VmWord getYieldHandler(DispatchMode mode)
+{
+    // the other modes run their own loops, or see every instruction anyway
+    if (mode != DispatchMode::Call && mode != DispatchMode::Threaded)
+        return 0;
+    return getInstructionHandlers(mode)[Index_Yield];
+}
+
+const char* getInstructionName(VmWord opcode)
+{
+#define INSTRUCTION_NAME(name) #name,
+    static const char* names[] = {
+        INSTRUCTION_LIST(INSTRUCTION_NAME)
+    };
+#undef INSTRUCTION_NAME
+
+    if (opcode >= sizeof(names) / sizeof(names[0]))
+        return "?";
+    return names[opcode];
 }
@@ -30,91 +30,90 @@
 
 #pragma once
 
+#include <cstdint>
 #include "VirtualMachine.h"
 
 class MemoryManager;
+class Profiler;
 class Program;
+class IConsole;
 class Stack;
-class Window;
 struct ExecutionContext;
+struct Instruction;
+
+typedef const Instruction*(*InstructionExecutor)(ExecutionContext* context, const Instruction* ip);
+
+// The interpreter can dispatch instructions in one of two ways: by calling each
+// handler through a function pointer and looping on the returned instruction
+// pointer, or by threading handlers together so each one jumps directly to the
+// next.  Threaded dispatch uses computed goto where the compiler supports it,
+// and falls back to tail calls between handler functions otherwise.  Native
+// mode compiles the program to machine code first (see NativeCompiler), and
+// uses the call handlers for anything it doesn't emit inline.  Tracing mode
+// interprets with the call handlers and compiles only hot loops (see Tracer).
+// Counting mode is call dispatch that also counts the instructions executed,
+// for benchmarking.  Profiling mode uses its own table of call handlers that
+// time every instruction (see Profiler), and Sampling mode is call dispatch
+// under a profiling timer (see Sampler).  Sequencing mode counts the runs of
+// instructions that execute back to back (see SequenceCounter).
+enum class DispatchMode
+{
+    Call,
+    Threaded,
+    Native,
+    Tracing,
+    Counting,
+    Profiling,
+    Sampling,
+    Sequencing
+};
 
-typedef VmWord*(*InstructionExecutor)(ExecutionContext* context, VmWord* ip);
+// Bytecode is decoded once at load time into a stream of fixed-size records so
+// handlers never have to unpack operand words while running.  Operands are
+// resolved to offsets into the activation frame, constants are looked up ahead
+// of time and jump targets point directly at the destination record.
+struct Instruction
+{
+    VmWord handler;
+    int32_t operands[3];
+    int64_t value;
+    const Instruction* target;
+};
 
+// All locals and temporaries live in one contiguous frame sized by Op_reserve;
+// locals come first, followed by temporaries.
 struct ExecutionContext
 {
-    VmWord* code;
-    Stack* stacks;
+    int64_t* frame;
+    Stack* stack;
     MemoryManager* memoryManager;
     const Program* program;
-    Window* window;
+    IConsole* console;
+    Profiler* profiler;     // only set while profiling
+
+    // only used when running in slices: the yield handler counts down the
+    // budget, then runs the record's own handler from yieldHandlers, or
+    // stops at the record once the budget is spent
+    int64_t budget;
+    const Instruction* code;
+    const VmWord* yieldHandlers;
+    const Instruction* resume;
 };
 
-VmWord* ExecuteNop(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteEnd(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteReserve(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteFreeMem(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteNewType(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteReadType(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteWriteType(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteNewArray(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteJmp(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteJmpZero(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteJmpNotZero(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteLoadConstant(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLoadString(ExecutionContext* context, VmWord* ip);
-
-VmWord* ExecuteAddIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteAddReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteAddStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteSubIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteSubReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteMulIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteMulReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteDivIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteDivReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteModIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteModReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteEqualIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteEqualReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteEqualStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteNotEqualIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteNotEqualReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteNotEqualStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLessIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLessReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLessStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteGreaterIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteGreaterReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteGreaterStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLessEqualsIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLessEqualsReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteLessEqualsStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteGreaterEqualsIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteGreaterEqualsReals(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteGreaterEqualsStrings(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteOrIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteAndIntegers(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteNegateInteger(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteNegateReal(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteNotInteger(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteIntegerToReal(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteRealToInteger(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteMove(ExecutionContext* context, VmWord* ip);
+// Returns the handler table for the given dispatch mode, indexed by opcode.
+// Each decoded instruction stores the handler for its opcode.
+const VmWord* getInstructionHandlers(DispatchMode mode);
+const char* getInstructionName(VmWord opcode);
 
-VmWord* ExecutePrintBoolean(ExecutionContext* context, VmWord* ip);
-VmWord* ExecutePrintInteger(ExecutionContext* context, VmWord* ip);
-VmWord* ExecutePrintReal(ExecutionContext* context, VmWord* ip);
-VmWord* ExecutePrintString(ExecutionContext* context, VmWord* ip);
-VmWord* ExecutePrintNewline(ExecutionContext* context, VmWord* ip);
+// Returns the handler for the longest superinstruction starting with the given
+// opcodes, or 0 if there isn't one or the dispatch mode doesn't use them; the
+// number of instructions it covers goes in length.
+VmWord getSuperinstructionHandler(DispatchMode mode, const VmWord* opcodes, int count, int& length);
 
-VmWord* ExecuteInputInteger(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteInputString(ExecutionContext* context, VmWord* ip);
+// Returns the handler the interpreter installs on backward jumps to run a
+// program in slices, or 0 if the dispatch mode can't be sliced.
+VmWord getYieldHandler(DispatchMode mode);
 
-VmWord* ExecuteFnLen(ExecutionContext* context, VmWord* ip);
-VmWord* ExecuteFnLeft(ExecutionContext* context, VmWord* ip);
+void executeCalls(ExecutionContext* context, const Instruction* ip);
+void executeThreaded(ExecutionContext* context, const Instruction* ip);
+uint64_t executeCounted(ExecutionContext* context, const Instruction* ip);
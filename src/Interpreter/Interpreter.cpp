@@ -29,118 +29,362 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cstdio>
+#include <limits>
+#include <vector>
 
 #include "Interpreter.h"
 #include "Instructions.h"
 #include "Opcodes.h"
 #include "Program.h"
-#include "Window.h"
 
-Interpreter::Interpreter(Window& window, const Program& program)
+Interpreter::Interpreter(IConsole& console, const Program& program, DispatchMode dispatchMode)
     :
-    mWindow(window),
+    mConsole(console),
     mProgram(program),
-    mStacks(new Stack[4]),
+    mDispatchMode(dispatchMode),
+    mFrame(),
+    mLocalCount(0),
     mMemoryManager(),
-    mCodeSize(mProgram.getCodeSize()),
-    mCode(new VmWord[mCodeSize])
+    mCodeSize(0),
+    mCode(nullptr),
+    mOpcodes(),
+    mOffsets(),
+    mRunLengths(),
+    mContext(),
+    mFinished(false),
+    mYieldHandlers(),
+    mNativeCompiler(),
+    mTracer(),
+    mProfiler(),
+    mSampler(),
+    mSequenceCounter(),
+    mExecutedCount(0)
 {
-    memcpy(mCode, mProgram.getCode(), sizeof(VmWord) * mCodeSize);
-
-    static InstructionExecutor translationTable[] = {
-        ExecuteNop,
-        ExecuteEnd,
-        ExecuteReserve,
-        ExecuteFreeMem,
-        ExecuteNewType,
-        ExecuteNewArray,
-        ExecuteReadType,
-        ExecuteWriteType,
-        ExecuteJmp,
-        ExecuteJmpZero,
-        ExecuteJmpNotZero,
-        ExecuteLoadConstant,
-        ExecuteLoadString,
-        ExecuteAddIntegers,
-        ExecuteAddReals,
-        ExecuteAddStrings,
-        ExecuteSubIntegers,
-        ExecuteSubReals,
-        ExecuteMulIntegers,
-        ExecuteMulReals,
-        ExecuteDivIntegers,
-        ExecuteDivReals,
-        ExecuteModIntegers,
-        ExecuteModReals,
-        ExecuteEqualIntegers,
-        ExecuteEqualReals,
-        ExecuteEqualStrings,
-        ExecuteNotEqualIntegers,
-        ExecuteNotEqualReals,
-        ExecuteNotEqualStrings,
-        ExecuteLessIntegers,
-        ExecuteLessReals,
-        ExecuteLessStrings,
-        ExecuteGreaterIntegers,
-        ExecuteGreaterReals,
-        ExecuteGreaterStrings,
-        ExecuteLessEqualsIntegers,
-        ExecuteLessEqualsReals,
-        ExecuteLessEqualsStrings,
-        ExecuteGreaterEqualsIntegers,
-        ExecuteGreaterEqualsReals,
-        ExecuteGreaterEqualsStrings,
-        ExecuteOrIntegers,
-        ExecuteAndIntegers,
-        ExecuteNegateInteger,
-        ExecuteNegateReal,
-        ExecuteNotInteger,
-        ExecuteIntegerToReal,
-        ExecuteRealToInteger,
-        ExecuteMove,
-        ExecutePrintBoolean,
-        ExecutePrintInteger,
-        ExecutePrintReal,
-        ExecutePrintString,
-        ExecutePrintNewline,
-        ExecuteInputInteger,
-        ExecuteInputString,
-        ExecuteFnLen,
-        ExecuteFnLeft
-    };
-    // translate code into applicable function calls
-    for (int ix = 0; ix < mCodeSize; ) {
-        int count = getInstructionSize(mCode[ix]);
-        mCode[ix] = (VmWord)translationTable[mCode[ix]];
-        ix += count;
-        assert(ix <= mCodeSize);
+    mContext.frame = nullptr;
+    mContext.stack = &mFrame;
+    mContext.memoryManager = &mMemoryManager;
+    mContext.program = &mProgram;
+    mContext.console = &mConsole;
+    mContext.profiler = nullptr;
+    mContext.budget = 0;
+    mContext.code = nullptr;
+    mContext.yieldHandlers = nullptr;
+    mContext.resume = nullptr;
+
+    // without native code for this processor, the threaded interpreter is the
+    // fastest engine left; it has to be chosen before decoding
+    if (mDispatchMode == DispatchMode::Native && !NativeCompiler::isSupported())
+        mDispatchMode = DispatchMode::Threaded;
+
+    decode(mProgram.getCode(), mProgram.getCodeSize());
+
+    // if compiling fails anyway, fall back to the call handlers the code was
+    // decoded with
+    if (mDispatchMode == DispatchMode::Native) {
+        if (!mNativeCompiler.compile(mProgram.getCode(), mProgram.getCodeSize(), mCode, mCodeSize))
+            mDispatchMode = DispatchMode::Call;
+    } else if (mDispatchMode == DispatchMode::Tracing) {
+        if (NativeCompiler::isSupported())
+            mTracer.attach(mCode, mOpcodes.data(), mCodeSize);
+        else
+            mDispatchMode = DispatchMode::Call;
+    } else if (mDispatchMode == DispatchMode::Profiling) {
+        mProfiler.attach(mCode, mOpcodes.data(), mOffsets.data(), mCodeSize, mProgram);
+    } else if (mDispatchMode == DispatchMode::Sampling) {
+        if (Sampler::isSupported())
+            mSampler.attach(mCode, mOffsets.data(), mCodeSize, mProgram);
+        else
+            mDispatchMode = DispatchMode::Call;
+    } else if (mDispatchMode == DispatchMode::Sequencing) {
+        mSequenceCounter.attach(mCode, mOpcodes.data(), mCodeSize);
     }
 }
 
 Interpreter::~Interpreter()
 {
-    delete[] mStacks;
     delete[] mCode;
 }
 
+void Interpreter::setTraceOptions(const TraceOptions& options)
+{
+    mTracer.setOptions(options);
+}
+
 InterpreterResult Interpreter::run()
 {
-    ExecutionContext context;
-    context.code = mCode;
-    context.stacks = mStacks;
-    context.memoryManager = &mMemoryManager;
-    context.program = &mProgram;
-    context.window = &mWindow;
+    mContext.budget = std::numeric_limits<int64_t>::max();
+    return execute();
+}
+
+InterpreterResult Interpreter::runSlice(int64_t budget)
+{
+    assert(budget > 0);
+    if (mYieldHandlers.empty())
+        installYieldChecks();
+    mContext.budget = budget;
+    return execute();
+}
+
+InterpreterResult Interpreter::execute()
+{
+    if (mFinished)
+        return InterpreterResult::ExecutionComplete;
+
+    // a slice that ran out stopped on a yield check, which counts again
+    const Instruction* ip = mContext.resume ? mContext.resume : mCode;
+    mContext.resume = nullptr;
 
-    VmWord* ip = &mCode[0];
+    if (mDispatchMode == DispatchMode::Native)
+        mNativeCompiler.run(&mContext);
+    else if (mDispatchMode == DispatchMode::Threaded)
+        executeThreaded(&mContext, ip);
+    else if (mDispatchMode == DispatchMode::Tracing)
+        mTracer.run(&mContext, mCode);
+    else if (mDispatchMode == DispatchMode::Counting)
+        mExecutedCount = executeCounted(&mContext, mCode);
+    else if (mDispatchMode == DispatchMode::Profiling)
+        mProfiler.run(&mContext, mCode);
+    else if (mDispatchMode == DispatchMode::Sampling)
+        mSampler.run(&mContext, mCode);
+    else if (mDispatchMode == DispatchMode::Sequencing)
+        mSequenceCounter.run(&mContext, mCode);
+    else
+        executeCalls(&mContext, ip);
 
-    do {
-        ip = ((InstructionExecutor)*ip)(&context, ip);
-    } while (ip != nullptr);
+    if (mContext.resume)
+        return InterpreterResult::Yielded;
+    mFinished = true;
 
-    mWindow.locate(25, 1);
-    mWindow.print("Press any key to continue");
-    (void)mWindow.runOnce();
+#ifdef DUMP_INTERNALS
+    if (mDispatchMode == DispatchMode::Tracing)
+        mTracer.dumpStats();
+#endif
 
     return InterpreterResult::ExecutionComplete;
 }
+
+void Interpreter::decode(const VmWord* code, int codeSize)
+{
+    // map each word offset to the index of the instruction starting there; one
+    // extra entry lets jumps target the end of the code
+    std::vector<int> indices(codeSize + 1, -1);
+    int count = 0;
+    for (int ix = 0; ix < codeSize; ) {
+        if (code[ix] == Op_reserve)
+            mLocalCount = (int64_t)(code[ix + 1] & OperandSizeMask);
+        indices[ix] = count++;
+        ix += getInstructionSize(code[ix]);
+        assert(ix <= codeSize);
+    }
+    indices[codeSize] = count;
+
+    // running off the end of the code behaves like an explicit END
+    mCodeSize = count + 1;
+    mCode = new Instruction[mCodeSize];
+    mOpcodes.assign(mCodeSize, Op_end);
+    mOffsets.assign(mCodeSize, codeSize);
+    mRunLengths.assign(mCodeSize, 1);
+
+    const VmWord* handlers = getInstructionHandlers(mDispatchMode);
+
+    Instruction* instruction = mCode;
+    for (int ix = 0; ix < codeSize; ix += getInstructionSize(code[ix]), ++instruction) {
+        VmWord opcode = code[ix];
+        VmWord word = getInstructionSize(opcode) > 1 ? code[ix + 1] : 0;
+
+        *instruction = Instruction();
+        instruction->handler = handlers[opcode];
+        mOpcodes[instruction - mCode] = opcode;
+        mOffsets[instruction - mCode] = ix;
+
+        switch (opcode) {
+        case Op_nop:
+        case Op_end:
+        case Op_print_nl:
+            break;
+
+        case Op_reserve:
+            // locals and temporaries share a single frame
+            instruction->value = (int64_t)(word & OperandSizeMask) + (int64_t)((word >> Operand1Shift) & OperandSizeMask);
+            break;
+
+        case Op_jmp:
+        case Op_jmpz:
+        case Op_jmpnz:
+        {
+            uint64_t target = (word >> JumpShift) & JumpSizeMask;
+            assert(target <= (uint64_t)codeSize && indices[target] != -1);
+            instruction->target = mCode + indices[target];
+            if (opcode != Op_jmp)
+                instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            break;
+        }
+
+        case Op_jeq_i:
+        case Op_jne_i:
+        case Op_jlt_i:
+        case Op_jgt_i:
+        case Op_jle_i:
+        case Op_jge_i:
+        case Op_jeq_st:
+        case Op_jne_st:
+        case Op_jlt_st:
+        case Op_jgt_st:
+        case Op_jle_st:
+        case Op_jge_st:
+        case Op_jeq_i_imm:
+        case Op_jne_i_imm:
+        case Op_jlt_i_imm:
+        case Op_jgt_i_imm:
+        case Op_jle_i_imm:
+        case Op_jge_i_imm:
+        {
+            uint64_t target = (word >> BranchShift) & BranchSizeMask;
+            assert(target <= (uint64_t)codeSize && indices[target] != -1);
+            instruction->target = mCode + indices[target];
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            if (getInstructionSize(opcode) == 3)
+                instruction->value = (int64_t)code[ix + 2];
+            else
+                instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            break;
+        }
+
+        case Op_for_next:
+        {
+            uint64_t target = code[ix + ForNextTargetWord];
+            assert(target <= (uint64_t)codeSize && indices[target] != -1);
+            instruction->target = mCode + indices[target];
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            instruction->operands[2] = getOperandOffset(word, Operand2Shift);
+            break;
+        }
+
+        case Op_new_type:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->value = (int64_t)((word >> MemShift) & MemSizeMask);
+            break;
+
+        case Op_read_type:
+        case Op_write_type:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            instruction->value = (int64_t)((word >> MemShift) & MemSizeMask);
+            break;
+
+        case Op_new_array:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            instruction->operands[2] = getOperandOffset(word, Operand2Shift);
+            instruction->value = (int64_t)((word >> ArrayElementShift) & ArrayElementSizeMask);
+            break;
+
+        case Op_load_c:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->value = mProgram.getIntegerConstant((int)((word >> Operand1Shift) & OperandSizeMask));
+            break;
+
+        case Op_add_i_imm:
+        case Op_sub_i_imm:
+        case Op_mul_i_imm:
+        case Op_eq_i_imm:
+        case Op_neq_i_imm:
+        case Op_lt_i_imm:
+        case Op_gt_i_imm:
+        case Op_lte_i_imm:
+        case Op_gte_i_imm:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            instruction->value = (int64_t)(int32_t)(word >> ImmediateShift);
+            break;
+
+        case Op_mov_imm:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->value = (int64_t)(int32_t)(word >> ImmediateShift);
+            break;
+
+        case Op_load_st:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->value = (int64_t)((word >> Operand1Shift) & OperandSizeMask);
+            break;
+
+        case Op_free_mem:
+        case Op_print_b:
+        case Op_print_i:
+        case Op_print_r:
+        case Op_print_st:
+        case Op_input_i:
+        case Op_input_st:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            break;
+
+        case Op_neg_i:
+        case Op_neg_r:
+        case Op_not_i:
+        case Op_i2r:
+        case Op_r2i:
+        case Op_mov:
+        case Op_fn_len:
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            break;
+
+        default:
+            // everything else takes a target and two arguments
+            instruction->operands[0] = getOperandOffset(word, Operand0Shift);
+            instruction->operands[1] = getOperandOffset(word, Operand1Shift);
+            instruction->operands[2] = getOperandOffset(word, Operand2Shift);
+            break;
+        }
+    }
+
+    *instruction = Instruction();
+    instruction->handler = handlers[Op_end];
+
+    // fuse runs of instructions that commonly execute together; every record
+    // keeps its operands, so only the handler of the first one changes
+    for (int ix = 0; ix < mCodeSize; ++ix) {
+        int length = 0;
+        VmWord handler = getSuperinstructionHandler(mDispatchMode, &mOpcodes[ix], mCodeSize - ix, length);
+        if (handler) {
+            mCode[ix].handler = handler;
+            mRunLengths[ix] = length;
+        }
+    }
+}
+
+void Interpreter::installYieldChecks()
+{
+    VmWord yieldHandler = getYieldHandler(mDispatchMode);
+    if (!yieldHandler)
+        return;
+
+    // a backward jump inside a superinstruction runs without going through
+    // its own record, so the record that starts the run checks instead
+    mYieldHandlers.assign(mCodeSize, 0);
+    for (int ix = 0; ix < mCodeSize; ++ix) {
+        bool backward = false;
+        for (int iy = ix; iy < ix + mRunLengths[ix] && iy < mCodeSize; ++iy)
+            backward = backward || (mCode[iy].target && mCode[iy].target <= mCode + iy);
+        if (backward) {
+            mYieldHandlers[ix] = mCode[ix].handler;
+            mCode[ix].handler = yieldHandler;
+        }
+    }
+
+    mContext.code = mCode;
+    mContext.yieldHandlers = mYieldHandlers.data();
+}
+
+int32_t Interpreter::getOperandOffset(VmWord word, int64_t shift) const
+{
+    VmWord operand = (word >> shift) & OperandSizeMask;
+    int32_t offset = int32_t(operand >> 2);
+
+    // the compiler only emits module-level locals and temporaries
+    assert((operand & 0x3) == StackLocals || (operand & 0x3) == StackTemporaries);
+    if ((operand & 0x3) == StackTemporaries)
+        offset += int32_t(mLocalCount);
+    return offset;
+}
@@ -31,34 +31,99 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 #include "Instructions.h"
 #include "MemoryManager.h"
+#include "NativeCompiler.h"
+#include "Profiler.h"
+#include "Sampler.h"
+#include "SequenceCounter.h"
 #include "Stack.h"
+#include "Tracer.h"
 
+class IConsole;
 class Program;
-class Window;
 
 enum class InterpreterResult
 {
     ExecutionComplete,
-    BadOpcode
+    BadOpcode,
+    Yielded
 };
 
 class Interpreter
 {
 public:
-    Interpreter(Window& window, const Program& program);
+    Interpreter(IConsole& console, const Program& program, DispatchMode dispatchMode = DispatchMode::Threaded);
     ~Interpreter();
 
     InterpreterResult run();
 
+    // Runs until the program ends or has taken budget backward jumps, and
+    // returns Yielded in the latter case; the next call carries on from there.
+    // Straight-line code is never interrupted, and only backward jumps pay
+    // for the check.  Only call and threaded dispatch can be sliced; other
+    // modes run to the end.
+    InterpreterResult runSlice(int64_t budget);
+
+    void setTraceOptions(const TraceOptions& options);
+    const Tracer& getTracer() const
+    {
+        return mTracer;
+    }
+
+    // only filled in by DispatchMode::Profiling
+    const Profiler& getProfiler() const
+    {
+        return mProfiler;
+    }
+
+    // only filled in by DispatchMode::Sampling
+    const Sampler& getSampler() const
+    {
+        return mSampler;
+    }
+
+    // only filled in by DispatchMode::Sequencing
+    const SequenceCounter& getSequenceCounter() const
+    {
+        return mSequenceCounter;
+    }
+
+    // only counted in DispatchMode::Counting
+    uint64_t getExecutedCount() const
+    {
+        return mExecutedCount;
+    }
+
 private:
-    Window& mWindow;
+    IConsole& mConsole;
     const Program& mProgram;
+    DispatchMode mDispatchMode;
 
-    Stack* mStacks;
+    Stack mFrame;
+    int64_t mLocalCount;
     MemoryManager mMemoryManager;
 
     int mCodeSize;
-    VmWord* mCode;
+    Instruction* mCode;
+    std::vector<VmWord> mOpcodes;
+    std::vector<int> mOffsets;
+    std::vector<int> mRunLengths;
+
+    ExecutionContext mContext;
+    bool mFinished;
+    std::vector<VmWord> mYieldHandlers;
+
+    NativeCompiler mNativeCompiler;
+    Tracer mTracer;
+    Profiler mProfiler;
+    Sampler mSampler;
+    SequenceCounter mSequenceCounter;
+    uint64_t mExecutedCount;
+
+    InterpreterResult execute();
+    void decode(const VmWord* code, int codeSize);
+    void installYieldChecks();
+    int32_t getOperandOffset(VmWord word, int64_t shift) const;
 };
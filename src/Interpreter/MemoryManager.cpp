@@ -29,13 +29,15 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cassert>
+#include <vector>
 #include "MemoryManager.h"
 #include "StringPiece.h"
 
 MemoryManager::MemoryManager()
     :
     mDescriptors(),
-    mNextDescId(1)
+    mNextDescId(1),
+    mConcatBuffer()
 {
     // intentionally left blank
 }
@@ -117,13 +119,12 @@ int64_t MemoryManager::addStrings(int64_t lhsDesc, int64_t rhsDesc)
         right = rhsMem + sizeof(int);
     }
 
-    static std::vector<char> buf;
-    buf.resize(leftLen + rightLen);
+    mConcatBuffer.resize(leftLen + rightLen);
     if (leftLen > 0)
-        memcpy(&buf[0], left, leftLen);
+        memcpy(&mConcatBuffer[0], left, leftLen);
     if (rightLen > 0)
-        memcpy(&buf[leftLen], right, rightLen);
-    return newString(&buf[0], leftLen + rightLen);
+        memcpy(&mConcatBuffer[leftLen], right, rightLen);
+    return newString(mConcatBuffer.data(), leftLen + rightLen);
 }
 
 int MemoryManager::compareStrings(int64_t lhsDesc, int64_t rhsDesc)
@@ -185,8 +186,7 @@ int64_t MemoryManager::newArray(int64_t lower, int64_t upper, int elementSize)
 
 int64_t MemoryManager::newDesc(int64_t descType, void* mem)
 {
-    int64_t count = int64_t(mDescriptors.size());
-    int64_t desc = (mNextDescId << 8) | descType;
+    int64_t desc = (mNextDescId++ << 8) | descType;
     mDescriptors[desc] = mem;
     return desc;
 }
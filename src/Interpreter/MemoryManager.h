@@ -32,6 +32,7 @@
 
 #include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 enum
 {
@@ -69,6 +70,7 @@ private:
 
     std::unordered_map<int64_t, void*> mDescriptors;
     int64_t mNextDescId;
+    std::vector<char> mConcatBuffer;
 
     struct ArrayDesc
     {
@@ -0,0 +1,705 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Instructions.h"
+#include "NativeCompiler.h"
+#include "Opcodes.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ZB_NATIVE_X64
+#endif
+
+typedef void(*NativeEntry)(ExecutionContext* context);
+typedef const Instruction*(*TraceEntry)(ExecutionContext* context);
+
+namespace
+{
+    enum Register
+    {
+        Rax = 0,
+        Rcx = 1,
+        Rdx = 2,
+        Rbx = 3,
+        Rsp = 4,
+        Rbp = 5,
+        Rsi = 6,
+        Rdi = 7,
+        R12 = 12,
+        R13 = 13
+    };
+
+#if defined(_WIN32)
+    const int Arg0 = Rcx;
+    const int Arg1 = Rdx;
+#else
+    const int Arg0 = Rdi;
+    const int Arg1 = Rsi;
+#endif
+
+    // condition codes, as used by setcc and jcc
+    enum Condition : uint8_t
+    {
+        CondOverflow = 0x0,
+        CondEqual = 0x4,
+        CondNotEqual = 0x5,
+        CondSign = 0x8,
+        CondLess = 0xc,
+        CondGreaterEqual = 0xd,
+        CondLessEqual = 0xe,
+        CondGreater = 0xf
+    };
+
+    // "op reg, r/m" forms of the two-operand integer instructions
+    enum Alu : uint8_t
+    {
+        AluAdd = 0x03,
+        AluOr = 0x0b,
+        AluAnd = 0x23,
+        AluSub = 0x2b,
+        AluCmp = 0x3b
+    };
+
+    // rbx holds the frame base and r12 the execution context while running
+    const int FrameRegister = Rbx;
+    const int ContextRegister = R12;
+}
+
+NativeCompiler::NativeCompiler()
+    :
+    mBuffer(),
+    mOffsets(),
+    mFixups(),
+    mPages(nullptr),
+    mPagesSize(0)
+{
+    // intentionally left blank
+}
+
+NativeCompiler::~NativeCompiler()
+{
+    release();
+}
+
+bool NativeCompiler::isSupported()
+{
+#ifdef ZB_NATIVE_X64
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool NativeCompiler::compile(const VmWord* code, int codeSize, const Instruction* instructions, int instructionCount)
+{
+    if (!isSupported())
+        return false;
+
+    release();
+    mBuffer.clear();
+    mOffsets.assign(instructionCount, 0);
+    mFixups.clear();
+
+    emitPrologue();
+
+    const Instruction* instruction = instructions;
+    for (int ix = 0; ix < codeSize; ix += getInstructionSize(code[ix]), ++instruction) {
+        assert(instruction - instructions < instructionCount);
+        placeLabel(int(instruction - instructions));
+
+        if (emitStraightLine(code[ix], instruction))
+            continue;
+
+        int target = instruction->target ? int(instruction->target - instructions) : -1;
+
+        int condition = emitBranchTest(code[ix], instruction);
+        if (condition >= 0) {
+            emitJumpIf(uint8_t(condition), target);
+            continue;
+        }
+
+        switch (code[ix]) {
+        case Op_nop:
+            break;
+
+        case Op_end:
+            emitEpilogue();
+            break;
+
+        case Op_jmp:
+            emitJump(target);
+            break;
+
+        case Op_for_next:
+            emitForNext(instruction, target, -1);
+            break;
+
+        case Op_jeq_st:
+        case Op_jne_st:
+        case Op_jlt_st:
+        case Op_jgt_st:
+        case Op_jle_st:
+        case Op_jge_st:
+            // let the handler compare, then branch on the instruction it returns
+            emitCall(instruction);
+            emitLoadImmediate(Rcx, (int64_t)(intptr_t)instruction->target);
+            emitAluRegister(AluCmp, Rax, Rcx);
+            emitJumpIf(CondEqual, target);
+            break;
+
+        default:
+            emitCall(instruction);
+            break;
+        }
+    }
+
+    // running off the end lands on the trailing END record
+    assert(instruction - instructions == instructionCount - 1);
+    placeLabel(instructionCount - 1);
+    emitEpilogue();
+
+    resolveFixups();
+    return finish();
+}
+
+bool NativeCompiler::compileTrace(const TraceStep* steps, int stepCount, uint64_t* iterations)
+{
+    if (!isSupported())
+        return false;
+
+    release();
+    mBuffer.clear();
+    mOffsets.clear();
+    mFixups.clear();
+
+    // every way out of the trace returns the instruction the interpreter
+    // resumes at; exits to the same instruction share a stub
+    std::vector<std::pair<int, const Instruction*>> exits;
+    auto sideExit = [&](const Instruction* resume) {
+        for (auto& exit : exits) {
+            if (exit.second == resume)
+                return exit.first;
+        }
+        exits.push_back({ newLabel(), resume });
+        return exits.back().first;
+    };
+    int exitWithResult = newLabel();
+    int loop = newLabel();
+
+    emitPrologue();
+    placeLabel(loop);
+
+    // ++*iterations
+    emitLoadImmediate(Rcx, (int64_t)(intptr_t)iterations);
+    emit(0x48);
+    emit(0xff);
+    emit(0x01);
+
+    for (int ix = 0; ix < stepCount; ++ix) {
+        const Instruction* instruction = steps[ix].instruction;
+        VmWord opcode = steps[ix].opcode;
+        assert(opcode != Op_end);
+
+        if (emitStraightLine(opcode, instruction))
+            continue;
+
+        // branches become guards: stay on the trace while they go the way
+        // they went during recording, otherwise resume at the other successor
+        bool taken = steps[ix].next != instruction + 1;
+
+        int condition = emitBranchTest(opcode, instruction);
+        if (condition >= 0) {
+            if (taken)
+                emitJumpIf(uint8_t(condition ^ 1), sideExit(instruction + 1));
+            else
+                emitJumpIf(uint8_t(condition), sideExit(instruction->target));
+            continue;
+        }
+
+        switch (opcode) {
+        case Op_nop:
+        case Op_jmp:
+            break;
+
+        case Op_for_next:
+            if (taken)
+                emitForNext(instruction, -1, sideExit(instruction + 1));
+            else
+                emitForNext(instruction, sideExit(instruction->target), -1);
+            break;
+
+        default:
+            // the handler picks the next instruction itself; leave the trace
+            // if it disagrees with the recording
+            emitCall(instruction);
+            emitLoadImmediate(Rcx, (int64_t)(intptr_t)steps[ix].next);
+            emitAluRegister(AluCmp, Rax, Rcx);
+            emitJumpIf(CondNotEqual, exitWithResult);
+            break;
+        }
+    }
+
+    // the recording ended back at the loop head
+    emitJump(loop);
+
+    for (auto& exit : exits) {
+        placeLabel(exit.first);
+        emitLoadImmediate(Rax, (int64_t)(intptr_t)exit.second);
+        emitEpilogue();
+    }
+    placeLabel(exitWithResult);
+    emitEpilogue();
+
+    resolveFixups();
+    return finish();
+}
+
+void NativeCompiler::run(ExecutionContext* context) const
+{
+    assert(mPages);
+    ((NativeEntry)mPages)(context);
+}
+
+const Instruction* NativeCompiler::runTrace(ExecutionContext* context) const
+{
+    assert(mPages);
+    return ((TraceEntry)mPages)(context);
+}
+
+bool NativeCompiler::emitStraightLine(VmWord opcode, const Instruction* instruction)
+{
+    const int32_t* operands = instruction->operands;
+
+    switch (opcode) {
+    case Op_load_c:
+    case Op_mov_imm:
+        emitLoadImmediate(Rax, instruction->value);
+        emitStore(operands[0], Rax);
+        return true;
+
+    case Op_mov:
+        emitLoad(Rax, operands[1]);
+        emitStore(operands[0], Rax);
+        return true;
+
+    case Op_add_i:
+    case Op_sub_i:
+    case Op_or_i:
+    case Op_and_i:
+    {
+        uint8_t alu = opcode == Op_add_i ? AluAdd : opcode == Op_sub_i ? AluSub : opcode == Op_or_i ? AluOr : AluAnd;
+        emitLoad(Rax, operands[1]);
+        emitAluSlot(alu, Rax, operands[2]);
+        emitStore(operands[0], Rax);
+        return true;
+    }
+
+    case Op_mul_i:
+        emitLoad(Rax, operands[1]);
+        emitMultiplySlot(Rax, operands[2]);
+        emitStore(operands[0], Rax);
+        return true;
+
+    case Op_add_i_imm:
+    case Op_sub_i_imm:
+        emitLoad(Rax, operands[1]);
+        emitLoadImmediate(Rcx, instruction->value);
+        emitAluRegister(opcode == Op_add_i_imm ? AluAdd : AluSub, Rax, Rcx);
+        emitStore(operands[0], Rax);
+        return true;
+
+    case Op_mul_i_imm:
+        emitLoad(Rax, operands[1]);
+        emitLoadImmediate(Rcx, instruction->value);
+        emit(0x48); // imul rax, rcx
+        emit(0x0f);
+        emit(0xaf);
+        emit(0xc1);
+        emitStore(operands[0], Rax);
+        return true;
+
+    case Op_neg_i:
+    case Op_not_i:
+        emitLoad(Rax, operands[1]);
+        emit(0x48); // neg rax / not rax
+        emit(0xf7);
+        emit(opcode == Op_neg_i ? 0xd8 : 0xd0);
+        emitStore(operands[0], Rax);
+        return true;
+
+    case Op_eq_i:
+    case Op_neq_i:
+    case Op_lt_i:
+    case Op_gt_i:
+    case Op_lte_i:
+    case Op_gte_i:
+    {
+        static const uint8_t conditions[] = { CondEqual, CondNotEqual, CondLess, CondGreater, CondLessEqual, CondGreaterEqual };
+        int which = opcode == Op_eq_i ? 0 : opcode == Op_neq_i ? 1 : opcode == Op_lt_i ? 2 : opcode == Op_gt_i ? 3 : opcode == Op_lte_i ? 4 : 5;
+        emitLoad(Rax, operands[1]);
+        emitAluSlot(AluCmp, Rax, operands[2]);
+        emitCompareSet(conditions[which], operands[0]);
+        return true;
+    }
+
+    case Op_eq_i_imm:
+    case Op_neq_i_imm:
+    case Op_lt_i_imm:
+    case Op_gt_i_imm:
+    case Op_lte_i_imm:
+    case Op_gte_i_imm:
+    {
+        static const uint8_t conditions[] = { CondEqual, CondNotEqual, CondLess, CondGreater, CondLessEqual, CondGreaterEqual };
+        emitLoad(Rax, operands[1]);
+        emitLoadImmediate(Rcx, instruction->value);
+        emitAluRegister(AluCmp, Rax, Rcx);
+        emitCompareSet(conditions[opcode - Op_eq_i_imm], operands[0]);
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+int NativeCompiler::emitBranchTest(VmWord opcode, const Instruction* instruction)
+{
+    static const uint8_t conditions[] = { CondEqual, CondNotEqual, CondLess, CondGreater, CondLessEqual, CondGreaterEqual };
+    const int32_t* operands = instruction->operands;
+
+    switch (opcode) {
+    case Op_jmpz:
+    case Op_jmpnz:
+        emitLoad(Rax, operands[0]);
+        emitAluRegister(0x85, Rax, Rax); // test rax, rax
+        return opcode == Op_jmpz ? CondEqual : CondNotEqual;
+
+    case Op_jeq_i:
+    case Op_jne_i:
+    case Op_jlt_i:
+    case Op_jgt_i:
+    case Op_jle_i:
+    case Op_jge_i:
+        emitLoad(Rax, operands[0]);
+        emitAluSlot(AluCmp, Rax, operands[1]);
+        return conditions[opcode - Op_jeq_i];
+
+    case Op_jeq_i_imm:
+    case Op_jne_i_imm:
+    case Op_jlt_i_imm:
+    case Op_jgt_i_imm:
+    case Op_jle_i_imm:
+    case Op_jge_i_imm:
+        emitLoad(Rax, operands[0]);
+        emitLoadImmediate(Rcx, instruction->value);
+        emitAluRegister(AluCmp, Rax, Rcx);
+        return conditions[opcode - Op_jeq_i_imm];
+
+    default:
+        return -1;
+    }
+}
+
+void NativeCompiler::emitForNext(const Instruction* instruction, int whenLooping, int whenDone)
+{
+    const int32_t* operands = instruction->operands;
+
+    // counter += step, then loop while counter <= limit (>= for a negative
+    // step); either outcome may be left to fall through by passing -1.  If
+    // the add overflows the loop is done and the counter is left as it was.
+    emitLoad(Rax, operands[0]);
+    emitLoad(Rcx, operands[2]);
+    emitAluRegister(AluAdd, Rax, Rcx);
+    size_t overflow = 0;
+    if (whenDone >= 0) {
+        emitJumpIf(CondOverflow, whenDone);
+    } else {
+        emit(0x70 | CondOverflow);
+        overflow = mBuffer.size();
+        emit(0);
+    }
+    emitStore(operands[0], Rax);
+    emitAluRegister(0x85, Rcx, Rcx); // test rcx, rcx
+    emit(0x70 | CondSign);
+    size_t negative = mBuffer.size();
+    emit(0);
+    emitAluSlot(AluCmp, Rax, operands[1]);
+    if (whenLooping >= 0)
+        emitJumpIf(CondLessEqual, whenLooping);
+    if (whenDone >= 0)
+        emitJumpIf(CondGreater, whenDone);
+    emit(0xeb);
+    size_t done = mBuffer.size();
+    emit(0);
+    mBuffer[negative] = uint8_t(mBuffer.size() - (negative + 1));
+    emitAluSlot(AluCmp, Rax, operands[1]);
+    if (whenLooping >= 0)
+        emitJumpIf(CondGreaterEqual, whenLooping);
+    if (whenDone >= 0)
+        emitJumpIf(CondLess, whenDone);
+    mBuffer[done] = uint8_t(mBuffer.size() - (done + 1));
+    if (overflow)
+        mBuffer[overflow] = uint8_t(mBuffer.size() - (overflow + 1));
+}
+
+void NativeCompiler::emit(uint8_t byte)
+{
+    mBuffer.push_back(byte);
+}
+
+void NativeCompiler::emit32(uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        emit(uint8_t(value >> (i * 8)));
+}
+
+void NativeCompiler::emit64(uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        emit(uint8_t(value >> (i * 8)));
+}
+
+void NativeCompiler::emitLoad(int reg, int32_t slot)
+{
+    // mov reg, [rbx + slot * 8]
+    emit(0x48 | (reg >= 8 ? 0x04 : 0));
+    emit(0x8b);
+    emit(0x80 | ((reg & 7) << 3) | FrameRegister);
+    emit32(uint32_t(slot * 8));
+}
+
+void NativeCompiler::emitStore(int32_t slot, int reg)
+{
+    // mov [rbx + slot * 8], reg
+    emit(0x48 | (reg >= 8 ? 0x04 : 0));
+    emit(0x89);
+    emit(0x80 | ((reg & 7) << 3) | FrameRegister);
+    emit32(uint32_t(slot * 8));
+}
+
+void NativeCompiler::emitLoadImmediate(int reg, int64_t value)
+{
+    // mov reg, imm64
+    emit(0x48 | (reg >= 8 ? 0x01 : 0));
+    emit(0xb8 | (reg & 7));
+    emit64(uint64_t(value));
+}
+
+void NativeCompiler::emitAluSlot(uint8_t opcode, int reg, int32_t slot)
+{
+    // op reg, [rbx + slot * 8]
+    emit(0x48 | (reg >= 8 ? 0x04 : 0));
+    emit(opcode);
+    emit(0x80 | ((reg & 7) << 3) | FrameRegister);
+    emit32(uint32_t(slot * 8));
+}
+
+void NativeCompiler::emitAluRegister(uint8_t opcode, int dst, int src)
+{
+    // op dst, src
+    assert(dst < 8 && src < 8);
+    emit(0x48);
+    emit(opcode);
+    emit(0xc0 | (dst << 3) | src);
+}
+
+void NativeCompiler::emitMultiplySlot(int reg, int32_t slot)
+{
+    // imul reg, [rbx + slot * 8]
+    emit(0x48 | (reg >= 8 ? 0x04 : 0));
+    emit(0x0f);
+    emit(0xaf);
+    emit(0x80 | ((reg & 7) << 3) | FrameRegister);
+    emit32(uint32_t(slot * 8));
+}
+
+void NativeCompiler::emitCompareSet(uint8_t condition, int32_t target)
+{
+    // setcc al; movzx eax, al; mov [rbx + target * 8], rax
+    emit(0x0f);
+    emit(0x90 | condition);
+    emit(0xc0);
+    emit(0x0f);
+    emit(0xb6);
+    emit(0xc0);
+    emitStore(target, Rax);
+}
+
+void NativeCompiler::emitJump(int target)
+{
+    emit(0xe9);
+    mFixups.push_back({ mBuffer.size(), target });
+    emit32(0);
+}
+
+void NativeCompiler::emitJumpIf(uint8_t condition, int target)
+{
+    emit(0x0f);
+    emit(0x80 | condition);
+    mFixups.push_back({ mBuffer.size(), target });
+    emit32(0);
+}
+
+void NativeCompiler::emitCall(const Instruction* instruction)
+{
+    // handler(context, instruction); the result is left in rax
+    emit(0x48 | 0x04 | (Arg0 >= 8 ? 0x01 : 0));
+    emit(0x89);
+    emit(0xc0 | ((ContextRegister & 7) << 3) | (Arg0 & 7));
+    emitLoadImmediate(Arg1, (int64_t)(intptr_t)instruction);
+    emitLoadImmediate(Rax, (int64_t)instruction->handler);
+    emit(0xff);
+    emit(0xd0);
+
+    // the handler may have resized the frame (see Op_reserve)
+    emit(0x49);
+    emit(0x8b);
+    emit(0x84 | (FrameRegister << 3));
+    emit(0x24);
+    emit32(uint32_t(offsetof(ExecutionContext, frame)));
+}
+
+void NativeCompiler::emitPrologue()
+{
+    // push rbx; push r12; push r13 (keeps the stack 16-byte aligned); sub rsp, 32
+    emit(0x53);
+    emit(0x41);
+    emit(0x54);
+    emit(0x41);
+    emit(0x55);
+    emit(0x48);
+    emit(0x83);
+    emit(0xec);
+    emit(0x20);
+
+    // mov r12, context; mov rbx, [r12 + frame]
+    emit(0x48 | (Arg0 >= 8 ? 0x04 : 0) | 0x01);
+    emit(0x89);
+    emit(0xc0 | ((Arg0 & 7) << 3) | (ContextRegister & 7));
+    emit(0x49);
+    emit(0x8b);
+    emit(0x84 | (FrameRegister << 3));
+    emit(0x24);
+    emit32(uint32_t(offsetof(ExecutionContext, frame)));
+}
+
+void NativeCompiler::emitEpilogue()
+{
+    // add rsp, 32; pop r13; pop r12; pop rbx; ret
+    emit(0x48);
+    emit(0x83);
+    emit(0xc4);
+    emit(0x20);
+    emit(0x41);
+    emit(0x5d);
+    emit(0x41);
+    emit(0x5c);
+    emit(0x5b);
+    emit(0xc3);
+}
+
+int NativeCompiler::newLabel()
+{
+    mOffsets.push_back(0);
+    return int(mOffsets.size() - 1);
+}
+
+void NativeCompiler::placeLabel(int label)
+{
+    mOffsets[label] = mBuffer.size();
+}
+
+void NativeCompiler::resolveFixups()
+{
+    for (auto& fixup : mFixups) {
+        assert(fixup.target >= 0 && fixup.target < int(mOffsets.size()));
+        int32_t displacement = int32_t(mOffsets[fixup.target] - (fixup.offset + 4));
+        memcpy(&mBuffer[fixup.offset], &displacement, sizeof(displacement));
+    }
+}
+
+bool NativeCompiler::finish()
+{
+    size_t size = mBuffer.size();
+
+#if defined(_WIN32)
+    void* pages = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (!pages)
+        return false;
+    memcpy(pages, mBuffer.data(), mBuffer.size());
+
+    DWORD oldProtect = 0;
+    if (!VirtualProtect(pages, size, PAGE_EXECUTE_READ, &oldProtect)) {
+        VirtualFree(pages, 0, MEM_RELEASE);
+        return false;
+    }
+#else
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size = (size + pageSize - 1) / pageSize * pageSize;
+
+    void* pages = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED)
+        return false;
+    memcpy(pages, mBuffer.data(), mBuffer.size());
+
+    if (mprotect(pages, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(pages, size);
+        return false;
+    }
+#endif
+
+    mPages = pages;
+    mPagesSize = size;
+    return true;
+}
+
+void NativeCompiler::release()
+{
+    if (!mPages)
+        return;
+
+#if defined(_WIN32)
+    VirtualFree(mPages, 0, MEM_RELEASE);
+#else
+    munmap(mPages, mPagesSize);
+#endif
+    mPages = nullptr;
+    mPagesSize = 0;
+}
@@ -0,0 +1,119 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "VirtualMachine.h"
+
+struct ExecutionContext;
+struct Instruction;
+
+// One instruction of a recorded trace, along with the instruction that ran
+// after it while recording.
+struct TraceStep
+{
+    const Instruction* instruction;
+    VmWord opcode;
+    const Instruction* next;
+};
+
+// Baseline native compiler for x86-64.  Each decoded instruction is turned into
+// a short run of machine code: integer arithmetic, comparisons and branches are
+// emitted inline against the frame, and everything else (strings, reals,
+// memory and I/O) calls the same handler the interpreter would use, so results
+// are identical between the two.
+//
+// The same emitters also compile recorded loop traces (see Tracer), where the
+// branches turn into guards that leave the trace when they go the other way.
+class NativeCompiler
+{
+public:
+    NativeCompiler();
+    ~NativeCompiler();
+
+    static bool isSupported();
+
+    bool compile(const VmWord* code, int codeSize, const Instruction* instructions, int instructionCount);
+    void run(ExecutionContext* context) const;
+
+    // compiles a loop recorded from its head; the code repeats the loop until
+    // a guard fails and returns the instruction to resume interpreting at
+    bool compileTrace(const TraceStep* steps, int stepCount, uint64_t* iterations);
+    const Instruction* runTrace(ExecutionContext* context) const;
+
+    size_t getCodeSize() const
+    {
+        return mBuffer.size();
+    }
+
+private:
+    struct JumpFixup
+    {
+        size_t offset;
+        int target;
+    };
+
+    std::vector<uint8_t> mBuffer;
+    std::vector<size_t> mOffsets;
+    std::vector<JumpFixup> mFixups;
+
+    void* mPages;
+    size_t mPagesSize;
+
+    void emit(uint8_t byte);
+    void emit32(uint32_t value);
+    void emit64(uint64_t value);
+
+    void emitLoad(int reg, int32_t slot);
+    void emitStore(int32_t slot, int reg);
+    void emitLoadImmediate(int reg, int64_t value);
+    void emitAluSlot(uint8_t opcode, int reg, int32_t slot);
+    void emitAluRegister(uint8_t opcode, int dst, int src);
+    void emitMultiplySlot(int reg, int32_t slot);
+    void emitCompareSet(uint8_t condition, int32_t target);
+    void emitJump(int target);
+    void emitJumpIf(uint8_t condition, int target);
+    void emitCall(const Instruction* instruction);
+    void emitPrologue();
+    void emitEpilogue();
+
+    bool emitStraightLine(VmWord opcode, const Instruction* instruction);
+    int emitBranchTest(VmWord opcode, const Instruction* instruction);
+    void emitForNext(const Instruction* instruction, int whenLooping, int whenDone);
+
+    int newLabel();
+    void placeLabel(int label);
+    void resolveFixups();
+
+    bool finish();
+    void release();
+};
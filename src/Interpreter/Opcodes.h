@@ -93,5 +93,34 @@ enum Opcode : VmWord
     Op_input_i,
     Op_input_st,
     Op_fn_len,
-    Op_fn_left
+    Op_fn_left,
+    Op_add_i_imm,
+    Op_sub_i_imm,
+    Op_mul_i_imm,
+    Op_eq_i_imm,
+    Op_neq_i_imm,
+    Op_lt_i_imm,
+    Op_gt_i_imm,
+    Op_lte_i_imm,
+    Op_gte_i_imm,
+    Op_mov_imm,
+    Op_jeq_i,
+    Op_jne_i,
+    Op_jlt_i,
+    Op_jgt_i,
+    Op_jle_i,
+    Op_jge_i,
+    Op_jeq_st,
+    Op_jne_st,
+    Op_jlt_st,
+    Op_jgt_st,
+    Op_jle_st,
+    Op_jge_st,
+    Op_jeq_i_imm,
+    Op_jne_i_imm,
+    Op_jlt_i_imm,
+    Op_jgt_i_imm,
+    Op_jle_i_imm,
+    Op_jge_i_imm,
+    Op_for_next
 };
@@ -0,0 +1,166 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+
+#include "Instructions.h"
+#include "Profiler.h"
+#include "Program.h"
+
+Profiler::Profiler()
+    :
+    mInstructions(nullptr),
+    mOpcodes(nullptr),
+    mOffsets(),
+    mLines(),
+    mSamples()
+{
+    // intentionally left blank
+}
+
+Profiler::~Profiler()
+{
+    // intentionally left blank
+}
+
+void Profiler::attach(const Instruction* instructions, const VmWord* opcodes, const int* offsets, int instructionCount, const Program& program)
+{
+    mInstructions = instructions;
+    mOpcodes = opcodes;
+    mOffsets.assign(offsets, offsets + instructionCount);
+    mSamples.assign(instructionCount, Sample());
+
+    mLines.resize(instructionCount);
+    for (int ix = 0; ix < instructionCount; ++ix)
+        mLines[ix] = program.getLine(offsets[ix]);
+}
+
+void Profiler::run(ExecutionContext* context, const Instruction* ip)
+{
+    assert(mInstructions);
+    context->profiler = this;
+    executeCalls(context, ip);
+    context->profiler = nullptr;
+}
+
+std::vector<InstructionProfile> Profiler::getInstructions() const
+{
+    std::vector<InstructionProfile> result;
+    result.reserve(mSamples.size());
+    for (size_t ix = 0; ix < mSamples.size(); ++ix)
+        result.push_back({ mOffsets[ix], mLines[ix], mOpcodes[ix], mSamples[ix].count, mSamples[ix].cycles });
+    return result;
+}
+
+std::vector<OpcodeProfile> Profiler::getOpcodes() const
+{
+    std::map<VmWord, OpcodeProfile> opcodes;
+    for (size_t ix = 0; ix < mSamples.size(); ++ix) {
+        if (!mSamples[ix].count)
+            continue;
+        auto& entry = opcodes.insert({ mOpcodes[ix], OpcodeProfile{ mOpcodes[ix], 0, 0 } }).first->second;
+        entry.count += mSamples[ix].count;
+        entry.cycles += mSamples[ix].cycles;
+    }
+
+    std::vector<OpcodeProfile> result;
+    for (auto& entry : opcodes)
+        result.push_back(entry.second);
+    std::stable_sort(result.begin(), result.end(), [](const OpcodeProfile& lhs, const OpcodeProfile& rhs) {
+        return lhs.cycles > rhs.cycles;
+    });
+    return result;
+}
+
+std::vector<LineProfile> Profiler::getLines() const
+{
+    std::map<int, LineProfile> lines;
+    for (size_t ix = 0; ix < mSamples.size(); ++ix) {
+        if (!mSamples[ix].count)
+            continue;
+        auto& entry = lines.insert({ mLines[ix], LineProfile{ mLines[ix], 0, 0 } }).first->second;
+        entry.count += mSamples[ix].count;
+        entry.cycles += mSamples[ix].cycles;
+    }
+
+    std::vector<LineProfile> result;
+    for (auto& entry : lines)
+        result.push_back(entry.second);
+    std::stable_sort(result.begin(), result.end(), [](const LineProfile& lhs, const LineProfile& rhs) {
+        return lhs.cycles > rhs.cycles;
+    });
+    return result;
+}
+
+void Profiler::report(FILE* file, int maxRows) const
+{
+    uint64_t totalCount = 0;
+    uint64_t totalCycles = 0;
+    for (auto& sample : mSamples) {
+        totalCount += sample.count;
+        totalCycles += sample.cycles;
+    }
+    double scale = totalCycles ? 100.0 / (double)totalCycles : 0.0;
+
+    fprintf(file, "%llu instructions, %llu cycles\n", (unsigned long long)totalCount, (unsigned long long)totalCycles);
+
+    fprintf(file, "\n  line       cycles      %%     executed  cycles/op\n");
+    auto lines = getLines();
+    for (int ix = 0; ix < (int)lines.size() && ix < maxRows; ++ix) {
+        auto& line = lines[ix];
+        fprintf(file, "%6d %12llu %6.2f %12llu %10.1f\n",
+            line.line, (unsigned long long)line.cycles, (double)line.cycles * scale,
+            (unsigned long long)line.count, (double)line.cycles / (double)line.count);
+    }
+
+    fprintf(file, "\n  opcode                               cycles      %%     executed  cycles/op\n");
+    auto opcodes = getOpcodes();
+    for (int ix = 0; ix < (int)opcodes.size() && ix < maxRows; ++ix) {
+        auto& opcode = opcodes[ix];
+        fprintf(file, "  %-32s %12llu %6.2f %12llu %10.1f\n",
+            getInstructionName(opcode.opcode), (unsigned long long)opcode.cycles, (double)opcode.cycles * scale,
+            (unsigned long long)opcode.count, (double)opcode.cycles / (double)opcode.count);
+    }
+
+    fprintf(file, "\n  offset    line  opcode                               cycles      %%     executed  cycles/op\n");
+    auto instructions = getInstructions();
+    std::stable_sort(instructions.begin(), instructions.end(), [](const InstructionProfile& lhs, const InstructionProfile& rhs) {
+        return lhs.cycles > rhs.cycles;
+    });
+    for (int ix = 0; ix < (int)instructions.size() && ix < maxRows && instructions[ix].count; ++ix) {
+        auto& instruction = instructions[ix];
+        fprintf(file, "  @%06X %6d  %-32s %12llu %6.2f %12llu %10.1f\n",
+            instruction.offset, instruction.line, getInstructionName(instruction.opcode),
+            (unsigned long long)instruction.cycles, (double)instruction.cycles * scale,
+            (unsigned long long)instruction.count, (double)instruction.cycles / (double)instruction.count);
+    }
+}
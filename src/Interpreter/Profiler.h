@@ -0,0 +1,126 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "VirtualMachine.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+class Program;
+struct ExecutionContext;
+struct Instruction;
+
+// Reads the processor's time-stamp counter, or a nanosecond clock on targets
+// that don't have one.
+inline uint64_t readCycleCounter()
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+struct InstructionProfile
+{
+    int offset;         // word offset in the bytecode
+    int line;           // source row, 0 for code outside any statement
+    VmWord opcode;
+    uint64_t count;
+    uint64_t cycles;
+};
+
+struct OpcodeProfile
+{
+    VmWord opcode;
+    uint64_t count;
+    uint64_t cycles;
+};
+
+struct LineProfile
+{
+    int line;
+    uint64_t count;     // instructions executed on the line
+    uint64_t cycles;
+};
+
+// Per-instruction execution profiler.  The interpreter runs a separate table
+// of call handlers that read the cycle counter around each instruction and
+// charge it here, so the other dispatch modes pay nothing for profiling.
+// Totals are kept per decoded instruction and rolled up by opcode and by
+// source line when asked for.
+class Profiler
+{
+public:
+    Profiler();
+    ~Profiler();
+
+    void attach(const Instruction* instructions, const VmWord* opcodes, const int* offsets, int instructionCount, const Program& program);
+    void run(ExecutionContext* context, const Instruction* ip);
+
+    void record(const Instruction* ip, uint64_t cycles)
+    {
+        Sample& sample = mSamples[ip - mInstructions];
+        ++sample.count;
+        sample.cycles += cycles;
+    }
+
+    // in code order
+    std::vector<InstructionProfile> getInstructions() const;
+
+    // most expensive first
+    std::vector<OpcodeProfile> getOpcodes() const;
+    std::vector<LineProfile> getLines() const;
+
+    void report(FILE* file, int maxRows = 20) const;
+
+private:
+    struct Sample
+    {
+        uint64_t count;
+        uint64_t cycles;
+    };
+
+    const Instruction* mInstructions;
+    const VmWord* mOpcodes;
+    std::vector<int> mOffsets;
+    std::vector<int> mLines;
+    std::vector<Sample> mSamples;
+};
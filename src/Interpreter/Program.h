@@ -35,17 +35,19 @@
 #include <vector>
 #include "VirtualMachine.h"
 #include "ConstantTable.h"
+#include "LineTable.h"
 #include "StringTable.h"
 
 class Program
 {
 public:
-    Program(const VmWord* code, int codeSize, const StringTable& stringTable, const ConstantTable& constantTable)
+    Program(const VmWord* code, int codeSize, const StringTable& stringTable, const ConstantTable& constantTable, const LineTable& lineTable)
         :
         mCode(code),
         mCodeSize(codeSize),
         mStringTable(stringTable),
-        mConstantTable(constantTable)
+        mConstantTable(constantTable),
+        mLineTable(lineTable)
     {
         assert(code);
         assert(codeSize > 0);
@@ -76,6 +78,27 @@ public:
         return mConstantTable.getIntegerConstant(index);
     }
 
+    // source row of the statement that emitted the code at a word offset
+    int getLine(int offset) const
+    {
+        return mLineTable.findLine(offset);
+    }
+
+    const StringTable& getStringTable() const
+    {
+        return mStringTable;
+    }
+
+    const ConstantTable& getConstantTable() const
+    {
+        return mConstantTable;
+    }
+
+    const LineTable& getLineTable() const
+    {
+        return mLineTable;
+    }
+
     void dumpStrings() const
     {
         mStringTable.dump();
@@ -87,4 +110,5 @@ private:
 
     const StringTable& mStringTable;
     const ConstantTable& mConstantTable;
+    const LineTable& mLineTable;
 };
@@ -0,0 +1,388 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cassert>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "BuildId.h"
+#include "ProgramImage.h"
+#include "Sha256.h"
+
+namespace
+{
+    // "ZBC" and an EOF byte; read back in the wrong byte order it won't match
+    const uint32_t kMagic = 0x1a43425a;
+
+    struct ImageHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t buildId;
+        uint64_t sourceLength;
+        uint8_t sourceDigest[kSha256Size];
+        uint32_t codeSize;
+        uint32_t constantCount;
+        uint32_t stringCount;
+        uint32_t lineCount;
+        uint32_t scopeCount;
+        uint32_t textSize;
+        uint64_t codeOffset;
+        uint64_t constantOffset;
+        uint64_t stringOffset;
+        uint64_t lineOffset;
+        uint64_t scopeOffset;
+        uint64_t textOffset;
+        uint64_t size;
+    };
+
+    // strings and scope names are null-terminated in the text section, so
+    // they can be used without copying
+    struct ImageString
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct ImageLine
+    {
+        int32_t offset;
+        int32_t row;
+        int32_t scope;
+    };
+
+    struct ImageScope
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        int32_t parent;
+    };
+
+    uint64_t Align(uint64_t offset)
+    {
+        return (offset + 7) & ~(uint64_t)7;
+    }
+
+    // sets the section's offset and returns the offset just past it
+    uint64_t Place(uint64_t end, uint64_t count, uint64_t elementSize, uint64_t& offset)
+    {
+        offset = Align(end);
+        return offset + count * elementSize;
+    }
+
+    bool IsSectionValid(uint64_t offset, uint64_t count, uint64_t elementSize, uint64_t size)
+    {
+        return offset % 8 == 0 && offset <= size && count * elementSize <= size - offset;
+    }
+
+    bool IsTextValid(const char* text, uint32_t textSize, uint32_t offset, uint32_t length)
+    {
+        return (uint64_t)offset + length < textSize && text[offset + length] == 0;
+    }
+}
+
+ProgramImage::ProgramImage()
+    :
+    mData(nullptr),
+    mSize(0),
+#ifdef _WIN32
+    mFile(INVALID_HANDLE_VALUE),
+    mMapping(nullptr),
+#endif
+    mCode(nullptr),
+    mCodeSize(0),
+    mStringPool(),
+    mStringTable(mStringPool),
+    mConstantTable(),
+    mLineTable()
+{
+    // intentionally left blank
+}
+
+ProgramImage::~ProgramImage()
+{
+    unload();
+}
+
+bool ProgramImage::save(const Program& program, const std::string& source, const std::string& filename, std::string& error)
+{
+    const StringTable& strings = program.getStringTable();
+    const ConstantTable& constants = program.getConstantTable();
+    const LineTable& lines = program.getLineTable();
+
+    std::string text;
+    std::vector<ImageString> stringIndex;
+    for (int ix = 0; ix < strings.getSize(); ++ix) {
+        auto& string = strings.getString(ix);
+        stringIndex.push_back({ (uint32_t)text.size(), (uint32_t)string.getLength() });
+        text.append(string.getText(), string.getLength());
+        text.push_back(0);
+    }
+
+    std::vector<ImageScope> scopeIndex;
+    for (int ix = 0; ix < lines.getScopeCount(); ++ix) {
+        auto& name = lines.getScopeName(ix);
+        scopeIndex.push_back({ (uint32_t)text.size(), (uint32_t)name.size(), lines.getScopeParent(ix) });
+        text.append(name);
+        text.push_back(0);
+    }
+
+    ImageHeader header = {};
+    header.magic = kMagic;
+    header.version = kProgramImageVersion;
+    header.buildId = getBuildId();
+    header.sourceLength = source.length();
+    computeSha256(source.data(), source.length(), header.sourceDigest);
+    header.codeSize = (uint32_t)program.getCodeSize();
+    header.constantCount = (uint32_t)constants.getSize();
+    header.stringCount = (uint32_t)stringIndex.size();
+    header.lineCount = (uint32_t)lines.getSize();
+    header.scopeCount = (uint32_t)scopeIndex.size();
+    header.textSize = (uint32_t)text.size();
+
+    uint64_t end = sizeof(ImageHeader);
+    end = Place(end, header.codeSize, sizeof(VmWord), header.codeOffset);
+    end = Place(end, header.constantCount, sizeof(int64_t), header.constantOffset);
+    end = Place(end, header.stringCount, sizeof(ImageString), header.stringOffset);
+    end = Place(end, header.lineCount, sizeof(ImageLine), header.lineOffset);
+    end = Place(end, header.scopeCount, sizeof(ImageScope), header.scopeOffset);
+    end = Place(end, header.textSize, sizeof(char), header.textOffset);
+    header.size = Align(end);
+
+    std::vector<uint8_t> image((size_t)header.size, 0);
+    memcpy(&image[0], &header, sizeof(header));
+    memcpy(&image[(size_t)header.codeOffset], program.getCode(), header.codeSize * sizeof(VmWord));
+    auto constantData = (int64_t*)&image[(size_t)header.constantOffset];
+    for (uint32_t ix = 0; ix < header.constantCount; ++ix)
+        constantData[ix] = constants.getIntegerConstant((int)ix);
+    if (!stringIndex.empty())
+        memcpy(&image[(size_t)header.stringOffset], stringIndex.data(), stringIndex.size() * sizeof(ImageString));
+    auto lineData = (ImageLine*)&image[(size_t)header.lineOffset];
+    for (uint32_t ix = 0; ix < header.lineCount; ++ix) {
+        auto& entry = lines.getEntry((int)ix);
+        lineData[ix] = { entry.offset, entry.row, entry.scope };
+    }
+    if (!scopeIndex.empty())
+        memcpy(&image[(size_t)header.scopeOffset], scopeIndex.data(), scopeIndex.size() * sizeof(ImageScope));
+    if (!text.empty())
+        memcpy(&image[(size_t)header.textOffset], text.data(), text.size());
+
+#ifdef _WIN32
+    FILE* file = nullptr;
+    (void)fopen_s(&file, filename.c_str(), "wb");
+#else
+    FILE* file = fopen(filename.c_str(), "wb");
+#endif
+    if (!file) {
+        error = "Failed to create file";
+        return false;
+    }
+    bool written = fwrite(image.data(), 1, image.size(), file) == image.size();
+    if (fclose(file) != 0)
+        written = false;
+    if (!written) {
+        error = "Failed to write file";
+        return false;
+    }
+    return true;
+}
+
+bool ProgramImage::load(const std::string& filename, std::string& error)
+{
+    unload();
+    if (!map(filename, error))
+        return false;
+    if (!attach(error)) {
+        unload();
+        return false;
+    }
+    return true;
+}
+
+void ProgramImage::unload()
+{
+#ifdef _WIN32
+    if (mData)
+        UnmapViewOfFile(mData);
+    if (mMapping)
+        CloseHandle(mMapping);
+    if (mFile != INVALID_HANDLE_VALUE)
+        CloseHandle(mFile);
+    mMapping = nullptr;
+    mFile = INVALID_HANDLE_VALUE;
+#else
+    if (mData)
+        munmap((void*)mData, mSize);
+#endif
+    mData = nullptr;
+    mSize = 0;
+    mCode = nullptr;
+    mCodeSize = 0;
+    mStringTable.reset();
+    mConstantTable.reset();
+    mLineTable.reset();
+}
+
+Program ProgramImage::getProgram() const
+{
+    assert(isLoaded());
+    return Program(mCode, mCodeSize, mStringTable, mConstantTable, mLineTable);
+}
+
+bool ProgramImage::isCompiledFrom(const std::string& source) const
+{
+    assert(isLoaded());
+    auto& header = *(const ImageHeader*)mData;
+    if (header.sourceLength != source.length())
+        return false;
+    uint8_t digest[kSha256Size];
+    computeSha256(source.data(), source.length(), digest);
+    return memcmp(digest, header.sourceDigest, kSha256Size) == 0;
+}
+
+bool ProgramImage::map(const std::string& filename, std::string& error)
+{
+#ifdef _WIN32
+    mFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (mFile == INVALID_HANDLE_VALUE) {
+        error = "Failed to open file";
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mFile, &size) || size.QuadPart < (LONGLONG)sizeof(ImageHeader)) {
+        error = "Not a compiled program";
+        return false;
+    }
+    mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMapping)
+        mData = (const uint8_t*)MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+    if (!mData) {
+        error = "Failed to map file";
+        return false;
+    }
+    mSize = (size_t)size.QuadPart;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        error = "Failed to open file";
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(ImageHeader)) {
+        close(fd);
+        error = "Not a compiled program";
+        return false;
+    }
+    // the mapping keeps its own reference to the file
+    void* data = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        error = "Failed to map file";
+        return false;
+    }
+    mData = (const uint8_t*)data;
+    mSize = (size_t)status.st_size;
+#endif
+    return true;
+}
+
+bool ProgramImage::attach(std::string& error)
+{
+    // the bytecode itself is trusted like the compiler's output, but the
+    // indexes are checked so a damaged file can't send them out of the image
+    auto& header = *(const ImageHeader*)mData;
+    if (header.magic != kMagic) {
+        error = "Not a compiled program";
+        return false;
+    }
+    if (header.version != kProgramImageVersion || header.buildId != getBuildId()) {
+        error = "Compiled by a different build of ZetaBASIC; recompile it";
+        return false;
+    }
+    if (header.size != mSize ||
+        header.codeSize == 0 || header.codeSize > INT_MAX ||
+        !IsSectionValid(header.codeOffset, header.codeSize, sizeof(VmWord), mSize) ||
+        !IsSectionValid(header.constantOffset, header.constantCount, sizeof(int64_t), mSize) ||
+        !IsSectionValid(header.stringOffset, header.stringCount, sizeof(ImageString), mSize) ||
+        !IsSectionValid(header.lineOffset, header.lineCount, sizeof(ImageLine), mSize) ||
+        !IsSectionValid(header.scopeOffset, header.scopeCount, sizeof(ImageScope), mSize) ||
+        !IsSectionValid(header.textOffset, header.textSize, sizeof(char), mSize)) {
+        error = "Compiled program is damaged";
+        return false;
+    }
+
+    auto text = (const char*)(mData + header.textOffset);
+    auto stringIndex = (const ImageString*)(mData + header.stringOffset);
+    for (uint32_t ix = 0; ix < header.stringCount; ++ix) {
+        if (!IsTextValid(text, header.textSize, stringIndex[ix].offset, stringIndex[ix].length)) {
+            error = "Compiled program is damaged";
+            return false;
+        }
+        mStringTable.attachString(StringPiece(text + stringIndex[ix].offset, (int)stringIndex[ix].length));
+    }
+
+    auto scopeIndex = (const ImageScope*)(mData + header.scopeOffset);
+    for (uint32_t ix = 0; ix < header.scopeCount; ++ix) {
+        auto& scope = scopeIndex[ix];
+        if (!IsTextValid(text, header.textSize, scope.nameOffset, scope.nameLength) ||
+            scope.parent < -1 || scope.parent >= (int32_t)ix) {
+            error = "Compiled program is damaged";
+            return false;
+        }
+        mLineTable.addScope(std::string(text + scope.nameOffset, scope.nameLength), scope.parent);
+    }
+
+    auto lineData = (const ImageLine*)(mData + header.lineOffset);
+    for (uint32_t ix = 0; ix < header.lineCount; ++ix) {
+        auto& line = lineData[ix];
+        if (line.offset < (ix ? lineData[ix - 1].offset : 0) || line.offset > (int32_t)header.codeSize ||
+            line.scope < -1 || line.scope >= (int32_t)header.scopeCount) {
+            error = "Compiled program is damaged";
+            return false;
+        }
+        mLineTable.addLine(line.offset, line.row, line.scope);
+    }
+
+    mConstantTable.assign((const int64_t*)(mData + header.constantOffset), (int)header.constantCount);
+    mCode = (const VmWord*)(mData + header.codeOffset);
+    mCodeSize = (int)header.codeSize;
+    return true;
+}
@@ -0,0 +1,93 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "ConstantTable.h"
+#include "LineTable.h"
+#include "Program.h"
+#include "StringPool.h"
+#include "StringTable.h"
+#include "VirtualMachine.h"
+
+// A compiled program saved to disk (.zbc).  Every section is 8-byte aligned
+// and stored in the host's byte order, so a loaded image is used where it was
+// mapped: the program's code and string text point straight into the file's
+// pages, which processes running the same image share through the page cache.
+// Only the small string, constant and line indexes are rebuilt on load.
+//
+// Images aren't portable between builds: the header records the ID of the
+// build that wrote it (see getBuildId), and only that build loads it.  Bump
+// kProgramImageVersion whenever the header's layout changes, so the ID is
+// always read from where it was written.  The header also records the
+// length and SHA-256 of the source the program was compiled from.
+const uint32_t kProgramImageVersion = 3;
+
+class ProgramImage
+{
+public:
+    ProgramImage();
+    ~ProgramImage();
+
+    static bool save(const Program& program, const std::string& source, const std::string& filename, std::string& error);
+
+    // maps and checks the file; on failure nothing stays mapped
+    bool load(const std::string& filename, std::string& error);
+    void unload();
+
+    bool isLoaded() const
+    {
+        return mData != nullptr;
+    }
+
+    // only valid while the image stays loaded
+    Program getProgram() const;
+
+    // compares the source's length and SHA-256 with the ones saved with it
+    bool isCompiledFrom(const std::string& source) const;
+
+private:
+    const uint8_t* mData;
+    size_t mSize;
+#ifdef _WIN32
+    void* mFile;
+    void* mMapping;
+#endif
+    const VmWord* mCode;
+    int mCodeSize;
+    StringPool mStringPool;
+    StringTable mStringTable;
+    ConstantTable mConstantTable;
+    LineTable mLineTable;
+
+    bool map(const std::string& filename, std::string& error);
+    bool attach(std::string& error);
+};
@@ -0,0 +1,149 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cstdlib>
+#include <string>
+
+#include "IConsole.h"
+#include "Runtime.h"
+
+Runtime::Runtime(IConsole& console)
+    :
+    mConsole(console),
+    mMemoryManager()
+{
+    // intentionally left blank
+}
+
+Runtime::~Runtime()
+{
+    // intentionally left blank
+}
+
+void Runtime::freeMem(int64_t desc)
+{
+    mMemoryManager.delMemory(desc);
+}
+
+int64_t Runtime::newType(int size)
+{
+    return mMemoryManager.newType(size);
+}
+
+int64_t Runtime::readType(int64_t desc, int offset)
+{
+    return mMemoryManager.readFromType(desc, offset);
+}
+
+void Runtime::writeType(int64_t desc, int64_t value, int offset)
+{
+    mMemoryManager.writeToType(desc, value, offset);
+}
+
+int64_t Runtime::newArray(int64_t lower, int64_t upper, int elementSize)
+{
+    return mMemoryManager.newArray(lower, upper, elementSize);
+}
+
+int64_t Runtime::loadString(const char* text, int length)
+{
+    return mMemoryManager.newString(text, length);
+}
+
+int64_t Runtime::addStrings(int64_t lhs, int64_t rhs)
+{
+    return mMemoryManager.addStrings(lhs, rhs);
+}
+
+int Runtime::compareStrings(int64_t lhs, int64_t rhs)
+{
+    return mMemoryManager.compareStrings(lhs, rhs);
+}
+
+void Runtime::printBoolean(int64_t value)
+{
+    mConsole.print(value == 1 ? "True" : "False");
+}
+
+void Runtime::printInteger(int64_t value)
+{
+    mConsole.printf("%lld", (long long)value);
+}
+
+void Runtime::printReal(int64_t value)
+{
+    mConsole.printf("%f", toReal(value));
+}
+
+void Runtime::printString(int64_t desc)
+{
+    const char* text = nullptr;
+    int length = 0;
+    mMemoryManager.getString(desc, text, length);
+    mConsole.printn(text, length);
+}
+
+void Runtime::printNewline()
+{
+    mConsole.printn("\n", 1);
+}
+
+int64_t Runtime::inputInteger()
+{
+    const std::string& text = mConsole.input();
+    return atoll(text.c_str());
+}
+
+int64_t Runtime::inputString()
+{
+    const std::string& text = mConsole.input();
+    return mMemoryManager.newString(text.data(), (int)text.length());
+}
+
+int64_t Runtime::fnLen(int64_t desc)
+{
+    const char* text = nullptr;
+    int length = 0;
+    mMemoryManager.getString(desc, text, length);
+    return (int64_t)length;
+}
+
+int64_t Runtime::fnLeft(int64_t desc, int64_t length)
+{
+    const char* text = nullptr;
+    int textLength = 0;
+    mMemoryManager.getString(desc, text, textLength);
+
+    if (length > textLength)
+        length = textLength;
+    if (length < 0)
+        length = 0;
+
+    return mMemoryManager.newString(text, (int)length);
+}
@@ -0,0 +1,88 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "MemoryManager.h"
+
+class IConsole;
+
+// Support library for programs translated to C++ by CppEmitter.  It carries
+// the parts of the interpreter's handlers that aren't plain integer or real
+// arithmetic (strings, user-defined types, arrays and console I/O); translated
+// programs hand it a StdioConsole, so they don't need SDL.
+class Runtime
+{
+public:
+    Runtime(IConsole& console);
+    ~Runtime();
+
+    void freeMem(int64_t desc);
+    int64_t newType(int size);
+    int64_t readType(int64_t desc, int offset);
+    void writeType(int64_t desc, int64_t value, int offset);
+    int64_t newArray(int64_t lower, int64_t upper, int elementSize);
+
+    int64_t loadString(const char* text, int length);
+    int64_t addStrings(int64_t lhs, int64_t rhs);
+    int compareStrings(int64_t lhs, int64_t rhs);
+
+    void printBoolean(int64_t value);
+    void printInteger(int64_t value);
+    void printReal(int64_t value);
+    void printString(int64_t desc);
+    void printNewline();
+
+    int64_t inputInteger();
+    int64_t inputString();
+
+    int64_t fnLen(int64_t desc);
+    int64_t fnLeft(int64_t desc, int64_t length);
+
+private:
+    IConsole& mConsole;
+    MemoryManager mMemoryManager;
+};
+
+// reals travel through the frame as their bit patterns
+inline double toReal(int64_t bits)
+{
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline int64_t fromReal(double value)
+{
+    int64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
@@ -0,0 +1,178 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+#include "Instructions.h"
+#include "LineTable.h"
+#include "Program.h"
+#include "Sampler.h"
+
+// the signal handler has no other way to find the running sampler, which is
+// why only one can run at a time
+static std::atomic<Sampler*> sActiveSampler(nullptr);
+
+Sampler::Sampler(int frequency)
+    :
+    mFrequency(frequency),
+    mInstructions(nullptr),
+    mOffsets(nullptr),
+    mProgram(nullptr),
+    mHits(),
+    mCurrent(nullptr)
+{
+    assert(frequency > 0 && frequency <= 1000000);
+}
+
+Sampler::~Sampler()
+{
+    // intentionally left blank
+}
+
+bool Sampler::isSupported()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return true;
+#endif
+}
+
+void Sampler::attach(const Instruction* instructions, const int* offsets, int instructionCount, const Program& program)
+{
+    mInstructions = instructions;
+    mOffsets = offsets;
+    mProgram = &program;
+    mHits.assign(instructionCount, 0);
+}
+
+void Sampler::run(ExecutionContext* context, const Instruction* ip)
+{
+    assert(mInstructions);
+#ifdef _WIN32
+    executeCalls(context, ip);
+#else
+    Sampler* idle = nullptr;
+    if (!sActiveSampler.compare_exchange_strong(idle, this))
+        throw std::runtime_error("Can't sample: another program is already being sampled");
+
+    // restart system calls so INPUT isn't cut short by a sample
+    struct sigaction action = {};
+    struct sigaction previousAction;
+    action.sa_handler = onSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, &previousAction) == -1) {
+        std::string error = std::string("Can't sample: failed to install the SIGPROF handler: ") + strerror(errno);
+        sActiveSampler = nullptr;
+        throw std::runtime_error(error);
+    }
+
+    long period = 1000000 / mFrequency;
+    struct itimerval timer = {};
+    timer.it_interval.tv_sec = period / 1000000;
+    timer.it_interval.tv_usec = period % 1000000;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) == -1) {
+        std::string error = std::string("Can't sample: failed to start the profiling timer: ") + strerror(errno);
+        sigaction(SIGPROF, &previousAction, nullptr);
+        sActiveSampler = nullptr;
+        throw std::runtime_error(error);
+    }
+
+    do {
+        mCurrent = ip;
+        ip = ((InstructionExecutor)ip->handler)(context, ip);
+    } while (ip != nullptr);
+    mCurrent = nullptr;
+
+    timer = {};
+    bool stopped = setitimer(ITIMER_PROF, &timer, nullptr) != -1;
+    std::string error = stopped ? "" : std::string("Failed to stop the profiling timer: ") + strerror(errno);
+    sigaction(SIGPROF, &previousAction, nullptr);
+    sActiveSampler = nullptr;
+    if (!stopped)
+        throw std::runtime_error(error);
+#endif
+}
+
+void Sampler::onSignal(int signal)
+{
+    Sampler* sampler = sActiveSampler;
+    if (!sampler)
+        return;
+    const Instruction* ip = sampler->mCurrent;
+    if (ip)
+        ++sampler->mHits[ip - sampler->mInstructions];
+}
+
+uint64_t Sampler::getSampleCount() const
+{
+    uint64_t total = 0;
+    for (auto hits : mHits)
+        total += hits;
+    return total;
+}
+
+void Sampler::writeFolded(FILE* file) const
+{
+    if (!mProgram)
+        return;
+    const LineTable& lineTable = mProgram->getLineTable();
+
+    // instructions that share a line and scope collapse into one stack
+    std::map<std::string, uint64_t> stacks;
+    for (size_t ix = 0; ix < mHits.size(); ++ix) {
+        if (!mHits[ix])
+            continue;
+
+        std::string stack = "line " + std::to_string(lineTable.findLine(mOffsets[ix]));
+        int scope = lineTable.findScope(mOffsets[ix]);
+        if (scope == -1)
+            stack = "main;" + stack;
+        for (; scope != -1; scope = lineTable.getScopeParent(scope))
+            stack = lineTable.getScopeName(scope) + ";" + stack;
+        stacks[stack] += mHits[ix];
+    }
+
+    for (auto& entry : stacks)
+        fprintf(file, "%s %llu\n", entry.first.c_str(), (unsigned long long)entry.second);
+}
@@ -0,0 +1,73 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+class Program;
+struct ExecutionContext;
+struct Instruction;
+
+// Statistical profiler.  A POSIX interval timer interrupts the program at a
+// fixed rate of CPU time, and the signal handler charges a sample to whatever
+// instruction the interpreter is on.  All the interpreter has to do is publish
+// its instruction pointer before each handler, which is cheap enough to leave
+// sampling on for whole runs.  Samples are written out as folded stacks (label
+// section, enclosing FOR loops, then the line) for flame graph tools.
+class Sampler
+{
+public:
+    explicit Sampler(int frequency = 997);
+    ~Sampler();
+
+    static bool isSupported();
+
+    void attach(const Instruction* instructions, const int* offsets, int instructionCount, const Program& program);
+
+    // throws std::runtime_error if the timer can't be set up, or if another
+    // sampler is running; the timer signal goes to the whole process, so only
+    // one program can be sampled at a time
+    void run(ExecutionContext* context, const Instruction* ip);
+
+    uint64_t getSampleCount() const;
+    void writeFolded(FILE* file) const;
+
+private:
+    int mFrequency;
+    const Instruction* mInstructions;
+    const int* mOffsets;
+    const Program* mProgram;
+    std::vector<uint32_t> mHits;
+    const Instruction* volatile mCurrent;
+
+    static void onSignal(int signal);
+};
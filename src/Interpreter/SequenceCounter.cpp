@@ -0,0 +1,116 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <tuple>
+
+#include "Instructions.h"
+#include "SequenceCounter.h"
+
+SequenceCounter::SequenceCounter()
+    :
+    mInstructions(nullptr),
+    mOpcodes(nullptr),
+    mPairs(),
+    mTriples(),
+    mExecutedCount(0)
+{
+    // intentionally left blank
+}
+
+SequenceCounter::~SequenceCounter()
+{
+    // intentionally left blank
+}
+
+void SequenceCounter::attach(const Instruction* instructions, const VmWord* opcodes, int instructionCount)
+{
+    mInstructions = instructions;
+    mOpcodes = opcodes;
+    mPairs.assign(instructionCount, 0);
+    mTriples.assign(instructionCount, 0);
+    mExecutedCount = 0;
+}
+
+void SequenceCounter::run(ExecutionContext* context, const Instruction* ip)
+{
+    assert(mInstructions);
+
+    // the last two instructions executed, as indices; the starting values
+    // can't look like a fall through
+    int last = -2;
+    int beforeLast = -4;
+    uint64_t count = 0;
+    do {
+        int index = int(ip - mInstructions);
+        if (index == last + 1) {
+            ++mPairs[last];
+            if (last == beforeLast + 1)
+                ++mTriples[beforeLast];
+        }
+        beforeLast = last;
+        last = index;
+
+        ip = ((InstructionExecutor)ip->handler)(context, ip);
+        ++count;
+    } while (ip != nullptr);
+    mExecutedCount += count;
+}
+
+std::vector<OpcodeSequence> SequenceCounter::getSequences(int length) const
+{
+    assert(length == 2 || length == 3);
+    const std::vector<uint64_t>& counts = length == 2 ? mPairs : mTriples;
+
+    std::map<std::tuple<VmWord, VmWord, VmWord>, uint64_t> totals;
+    for (size_t ix = 0; ix + length <= counts.size(); ++ix) {
+        if (!counts[ix])
+            continue;
+        VmWord third = length == 3 ? mOpcodes[ix + 2] : 0;
+        totals[std::make_tuple(mOpcodes[ix], mOpcodes[ix + 1], third)] += counts[ix];
+    }
+
+    std::vector<OpcodeSequence> result;
+    for (auto& entry : totals) {
+        OpcodeSequence sequence = {};
+        sequence.opcodes[0] = std::get<0>(entry.first);
+        sequence.opcodes[1] = std::get<1>(entry.first);
+        sequence.opcodes[2] = std::get<2>(entry.first);
+        sequence.length = length;
+        sequence.count = entry.second;
+        result.push_back(sequence);
+    }
+    std::stable_sort(result.begin(), result.end(), [](const OpcodeSequence& lhs, const OpcodeSequence& rhs) {
+        return lhs.count > rhs.count;
+    });
+    return result;
+}
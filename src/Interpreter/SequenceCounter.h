@@ -0,0 +1,74 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "VirtualMachine.h"
+
+struct ExecutionContext;
+struct Instruction;
+
+struct OpcodeSequence
+{
+    VmWord opcodes[3];
+    int length;
+    uint64_t count;
+};
+
+// Counts how often runs of two and three instructions execute back to back.
+// Only runs where control falls through from one instruction to the next are
+// counted, since those are the only ones a superinstruction can stand in for.
+// Counts are kept per position in the code and added up by opcode when asked
+// for.
+class SequenceCounter
+{
+public:
+    SequenceCounter();
+    ~SequenceCounter();
+
+    void attach(const Instruction* instructions, const VmWord* opcodes, int instructionCount);
+    void run(ExecutionContext* context, const Instruction* ip);
+
+    uint64_t getExecutedCount() const
+    {
+        return mExecutedCount;
+    }
+
+    // most frequent first; length is 2 or 3
+    std::vector<OpcodeSequence> getSequences(int length) const;
+
+private:
+    const Instruction* mInstructions;
+    const VmWord* mOpcodes;
+    std::vector<uint64_t> mPairs;
+    std::vector<uint64_t> mTriples;
+    uint64_t mExecutedCount;
+};
@@ -28,6 +28,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -94,12 +95,19 @@ void Stack::setLocal(int index, int64_t value)
     mData[index] = value;
 }
 
+int64_t* Stack::getSlot(int index)
+{
+    assert(index >= 0 && index < mCapacity);
+    return &mData[index];
+}
+
 void Stack::ensureSpace(int64_t count)
 {
-    assert(count < kDefaultStackCapacity);
+    assert(count >= 0);
 
+    // a frame is reserved in one go, so it may need more than double
     if (mPointer + count > mCapacity) {
-        mCapacity *= 2;
+        mCapacity = std::max(mCapacity * 2, mPointer + count);
         int64_t* newData = new int64_t[mCapacity];
         memcpy(newData, mData, sizeof(int64_t) * mPointer);
         delete[] mData;
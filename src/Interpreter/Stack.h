@@ -47,6 +47,10 @@ public:
     int64_t getLocal(int index);
     void setLocal(int index, int64_t value);
 
+    // returns the address of a slot; the storage for a frame never moves once
+    // reserved, so the address stays valid for the life of the program
+    int64_t* getSlot(int index);
+
 private:
     int64_t mCapacity;
     int64_t mPointer;
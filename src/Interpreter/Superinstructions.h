@@ -0,0 +1,62 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+// Generated by zbsequences from the most frequent runs of instructions in:
+//
+//     array_alloc.bas
+//     goto_state_machine.bas
+//     numeric_loops.bas
+//     print_heavy.bas
+//     real_math.bas
+//     string_building.bas
+//     udt_access.bas
+//
+// Regenerate with `make sequences` rather than editing by hand.
+
+#define SUPERINSTRUCTION_PAIRS(X) \
+    X(LoadConstant, ModIntegers) \
+    X(Move, ForNext) \
+    X(AddIntegers, Move) \
+    X(MulIntegers, LoadConstant) \
+    X(ModIntegers, AddIntegers) \
+    X(AddIntegerImmediate, Move) \
+    X(Move, JumpLessEqualsIntegerImmediate) \
+    X(MoveImmediate, Jmp)
+
+#define SUPERINSTRUCTION_TRIPLES(X) \
+    X(AddIntegers, Move, ForNext) \
+    X(LoadConstant, ModIntegers, AddIntegers) \
+    X(MulIntegers, LoadConstant, ModIntegers) \
+    X(ModIntegers, AddIntegers, Move) \
+    X(AddIntegerImmediate, Move, JumpLessEqualsIntegerImmediate) \
+    X(ReadType, ReadType, AddIntegers) \
+    X(ReadType, AddIntegers, WriteType) \
+    X(AddIntegers, WriteType, ReadType)
@@ -0,0 +1,187 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cassert>
+#include <cstdio>
+
+#include "Instructions.h"
+#include "Tracer.h"
+
+TraceOptions::TraceOptions()
+    :
+    hotThreshold(64),
+    maxLength(256),
+    maxAttempts(4)
+{
+    // intentionally left blank
+}
+
+Tracer::Tracer()
+    :
+    mOptions(),
+    mInstructions(nullptr),
+    mOpcodes(nullptr),
+    mAnchors(),
+    mTraces(),
+    mAbortCount(0),
+    mRecordingAnchor(nullptr),
+    mSteps()
+{
+    // intentionally left blank
+}
+
+Tracer::~Tracer()
+{
+    clear();
+}
+
+void Tracer::setOptions(const TraceOptions& options)
+{
+    assert(options.hotThreshold > 0 && options.maxLength > 0);
+    mOptions = options;
+}
+
+void Tracer::attach(const Instruction* instructions, const VmWord* opcodes, int instructionCount)
+{
+    clear();
+    mInstructions = instructions;
+    mOpcodes = opcodes;
+    mAnchors.assign(instructionCount, Anchor());
+}
+
+void Tracer::run(ExecutionContext* context, const Instruction* ip)
+{
+    assert(mInstructions);
+
+    while (ip) {
+        auto next = ((InstructionExecutor)ip->handler)(context, ip);
+        if (mRecordingAnchor)
+            record(ip, next);
+        if (next && next <= ip)
+            next = enterLoop(context, next);
+        ip = next;
+    }
+}
+
+std::vector<TraceStats> Tracer::getStats() const
+{
+    std::vector<TraceStats> stats;
+    for (auto trace : mTraces)
+        stats.push_back(trace->stats);
+    return stats;
+}
+
+void Tracer::dumpStats() const
+{
+    printf("%d traces, %d abandoned recordings\n", (int)mTraces.size(), mAbortCount);
+    for (auto trace : mTraces) {
+        const TraceStats& stats = trace->stats;
+        printf("  @%06X: %d instructions, %d bytes, %llu entries, %llu iterations\n",
+            stats.anchor, stats.length, (int)stats.codeSize,
+            (unsigned long long)stats.entries, (unsigned long long)stats.iterations);
+    }
+}
+
+const Instruction* Tracer::enterLoop(ExecutionContext* context, const Instruction* target)
+{
+    // loops nested inside the one being recorded get traces of their own
+    if (mRecordingAnchor) {
+        abortRecording();
+        return target;
+    }
+
+    Anchor& anchor = mAnchors[target - mInstructions];
+    if (anchor.trace) {
+        ++anchor.trace->stats.entries;
+        return anchor.trace->compiler.runTrace(context);
+    }
+
+    if (anchor.attempts < mOptions.maxAttempts && ++anchor.hits >= mOptions.hotThreshold) {
+        mRecordingAnchor = target;
+        mSteps.clear();
+    }
+    return target;
+}
+
+void Tracer::record(const Instruction* ip, const Instruction* next)
+{
+    // END can't be part of a loop
+    if (!next || (int)mSteps.size() >= mOptions.maxLength) {
+        abortRecording();
+        return;
+    }
+
+    mSteps.push_back({ ip, mOpcodes[ip - mInstructions], next });
+    if (next == mRecordingAnchor)
+        finishRecording();
+}
+
+void Tracer::finishRecording()
+{
+    Anchor& anchor = mAnchors[mRecordingAnchor - mInstructions];
+
+    Trace* trace = new Trace();
+    trace->stats.anchor = int(mRecordingAnchor - mInstructions);
+    trace->stats.length = (int)mSteps.size();
+    trace->stats.entries = 0;
+    trace->stats.iterations = 0;
+    if (!trace->compiler.compileTrace(mSteps.data(), (int)mSteps.size(), &trace->stats.iterations)) {
+        delete trace;
+        abortRecording();
+        return;
+    }
+    trace->stats.codeSize = trace->compiler.getCodeSize();
+
+    anchor.trace = trace;
+    mTraces.push_back(trace);
+    mRecordingAnchor = nullptr;
+    mSteps.clear();
+}
+
+void Tracer::abortRecording()
+{
+    Anchor& anchor = mAnchors[mRecordingAnchor - mInstructions];
+    ++anchor.attempts;
+    anchor.hits = 0;
+    ++mAbortCount;
+
+    mRecordingAnchor = nullptr;
+    mSteps.clear();
+}
+
+void Tracer::clear()
+{
+    for (auto trace : mTraces)
+        delete trace;
+    mTraces.clear();
+    mAnchors.clear();
+    mAbortCount = 0;
+    mRecordingAnchor = nullptr;
+    mSteps.clear();
+}
@@ -0,0 +1,112 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "NativeCompiler.h"
+#include "VirtualMachine.h"
+
+struct ExecutionContext;
+struct Instruction;
+
+// Tunables for trace recording.
+struct TraceOptions
+{
+    TraceOptions();
+
+    int hotThreshold;   // backward jumps to a loop head before it is recorded
+    int maxLength;      // instructions recorded before a trace is abandoned
+    int maxAttempts;    // abandoned recordings before a loop head is left alone
+};
+
+struct TraceStats
+{
+    int anchor;         // instruction index of the loop head
+    int length;         // instructions in the trace
+    size_t codeSize;    // bytes of native code
+    uint64_t entries;   // times the interpreter entered the trace
+    uint64_t iterations;    // passes through the loop head while on the trace
+};
+
+// Trace-recording JIT for hot loops.  The interpreter runs the call handlers,
+// counting backward jumps per target.  Once a target is hot the instructions
+// actually executed are recorded until control gets back to it, and that
+// linear trace is compiled with guards on each branch.  Later jumps to the
+// loop head run the trace until a guard fails, which hands the instruction to
+// resume at back to the interpreter.
+class Tracer
+{
+public:
+    Tracer();
+    ~Tracer();
+
+    void setOptions(const TraceOptions& options);
+    void attach(const Instruction* instructions, const VmWord* opcodes, int instructionCount);
+    void run(ExecutionContext* context, const Instruction* ip);
+
+    std::vector<TraceStats> getStats() const;
+    int getAbortCount() const
+    {
+        return mAbortCount;
+    }
+    void dumpStats() const;
+
+private:
+    struct Trace
+    {
+        NativeCompiler compiler;
+        TraceStats stats;
+    };
+
+    struct Anchor
+    {
+        int hits;
+        int attempts;
+        Trace* trace;
+    };
+
+    TraceOptions mOptions;
+    const Instruction* mInstructions;
+    const VmWord* mOpcodes;
+    std::vector<Anchor> mAnchors;
+    std::vector<Trace*> mTraces;
+    int mAbortCount;
+
+    const Instruction* mRecordingAnchor;
+    std::vector<TraceStep> mSteps;
+
+    const Instruction* enterLoop(ExecutionContext* context, const Instruction* target);
+    void record(const Instruction* ip, const Instruction* next);
+    void finishRecording();
+    void abortRecording();
+    void clear();
+};
@@ -35,5 +35,9 @@ int getInstructionSize(VmWord word)
 {
     if (word == Op_nop || word == Op_end || word == Op_print_nl)
         return 1;
+    if (word >= Op_jeq_i_imm && word <= Op_jge_i_imm)
+        return 3;
+    if (word == Op_for_next)
+        return 3;
     return 2;
 }
@@ -61,6 +61,20 @@ const int64_t JumpShift = 16;
 const int64_t MemSizeMask = 0xffffff;
 const int64_t MemShift = 32;
 
+// immediate values are signed 32-bit integers that always follow operand 0 and 1
+const int64_t ImmediateShift = 32;
+const int64_t MinImmediateValue = INT32_MIN;
+const int64_t MaxImmediateValue = INT32_MAX;
+
+// fused compare-and-branch targets always follow operand 0 and 1; the immediate
+// forms carry their value in a third word
+const int64_t BranchSizeMask = 0xffffffff;
+const int64_t BranchShift = 32;
+
+// for_next takes the counter, limit and step operands, with its target in a
+// second word
+const int64_t ForNextTargetWord = 2;
+
 // array element size always follows 3 operands
 const int64_t ArrayElementSizeMask = 0xffff;
 const int64_t ArrayElementShift = 48;
\ No newline at end of file
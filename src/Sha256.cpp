@@ -0,0 +1,125 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+
+#include "Sha256.h"
+
+namespace
+{
+    const uint32_t kRoundConstants[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    uint32_t RotateRight(uint32_t value, int count)
+    {
+        return (value >> count) | (value << (32 - count));
+    }
+
+    void Compress(uint32_t state[8], const uint8_t block[64])
+    {
+        uint32_t w[64];
+        for (int ix = 0; ix < 16; ++ix)
+            w[ix] = ((uint32_t)block[ix * 4] << 24) | ((uint32_t)block[ix * 4 + 1] << 16) | ((uint32_t)block[ix * 4 + 2] << 8) | block[ix * 4 + 3];
+        for (int ix = 16; ix < 64; ++ix) {
+            uint32_t s0 = RotateRight(w[ix - 15], 7) ^ RotateRight(w[ix - 15], 18) ^ (w[ix - 15] >> 3);
+            uint32_t s1 = RotateRight(w[ix - 2], 17) ^ RotateRight(w[ix - 2], 19) ^ (w[ix - 2] >> 10);
+            w[ix] = w[ix - 16] + s0 + w[ix - 7] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int ix = 0; ix < 64; ++ix) {
+            uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+            uint32_t choice = (e & f) ^ (~e & g);
+            uint32_t t1 = h + s1 + choice + kRoundConstants[ix] + w[ix];
+            uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+            uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = s0 + majority;
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+void computeSha256(const void* data, size_t size, uint8_t digest[kSha256Size])
+{
+    uint32_t state[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    auto bytes = (const uint8_t*)data;
+    size_t whole = size & ~(size_t)63;
+    for (size_t offset = 0; offset < whole; offset += 64)
+        Compress(state, bytes + offset);
+
+    // the rest of the data, a 1 bit, zeros, and the length in bits, which
+    // takes one or two more blocks
+    uint8_t tail[128] = {};
+    size_t rest = size - whole;
+    if (rest)
+        memcpy(tail, bytes + whole, rest);
+    tail[rest] = 0x80;
+    size_t tailSize = rest < 56 ? 64 : 128;
+    uint64_t bits = (uint64_t)size * 8;
+    for (int ix = 0; ix < 8; ++ix)
+        tail[tailSize - 1 - ix] = (uint8_t)(bits >> (ix * 8));
+    for (size_t offset = 0; offset < tailSize; offset += 64)
+        Compress(state, tail + offset);
+
+    for (int ix = 0; ix < 8; ++ix) {
+        digest[ix * 4] = (uint8_t)(state[ix] >> 24);
+        digest[ix * 4 + 1] = (uint8_t)(state[ix] >> 16);
+        digest[ix * 4 + 2] = (uint8_t)(state[ix] >> 8);
+        digest[ix * 4 + 3] = (uint8_t)state[ix];
+    }
+}
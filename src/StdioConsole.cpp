@@ -0,0 +1,121 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cassert>
+#include <cstdarg>
+#include <cstring>
+
+#include "StdioConsole.h"
+
+StdioConsole::StdioConsole(FILE* output, FILE* input)
+    :
+    mOutput(output),
+    mInput(input),
+    mLength(0),
+    mText()
+{
+    assert(mOutput);
+    assert(mInput);
+}
+
+StdioConsole::~StdioConsole()
+{
+    flush();
+}
+
+void StdioConsole::print(const char* text)
+{
+    printn(text, (int)strlen(text));
+}
+
+void StdioConsole::printf(const char* format, ...)
+{
+    char buf[1024];
+    va_list ap;
+
+    va_start(ap, format);
+#ifdef _WIN32
+    int len = vsprintf_s(buf, sizeof(buf), format, ap);
+#else
+    int len = vsnprintf(buf, sizeof(buf), format, ap);
+#endif
+    va_end(ap);
+
+    printn(buf, len);
+}
+
+void StdioConsole::printn(const char* text, int len)
+{
+    while (len > 0) {
+        if (mLength == kBufferSize)
+            flush();
+
+        // like Window, text shorter than len is padded out with spaces
+        char ch = *text;
+        if (!ch)
+            ch = ' ';
+        else
+            ++text;
+        --len;
+
+        mBuffer[mLength++] = ch;
+    }
+}
+
+const std::string& StdioConsole::input(int maxLength, bool allowEscape, bool moveToNextLine)
+{
+    flush();
+
+    mText.clear();
+    int ch;
+    while ((ch = fgetc(mInput)) != EOF && ch != '\n') {
+        if (ch != '\r' && (maxLength < 0 || (int)mText.length() < maxLength))
+            mText += (char)ch;
+    }
+    return mText;
+}
+
+void StdioConsole::locate(int row, int col)
+{
+    // intentionally left blank
+}
+
+void StdioConsole::color(int fg, int bg)
+{
+    // intentionally left blank
+}
+
+void StdioConsole::flush()
+{
+    if (mLength > 0) {
+        fwrite(mBuffer, 1, mLength, mOutput);
+        mLength = 0;
+    }
+    fflush(mOutput);
+}
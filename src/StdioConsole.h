@@ -0,0 +1,66 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Jason Hoyt
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include "IConsole.h"
+
+// Console on top of stdin/stdout.  Output is collected in a large buffer and
+// written out in big chunks, only flushing early when the program asks for
+// input; cursor placement and colors don't apply to a stream and are ignored.
+class StdioConsole
+    :
+    public IConsole
+{
+public:
+    StdioConsole(FILE* output = stdout, FILE* input = stdin);
+    virtual ~StdioConsole();
+
+    virtual void print(const char* text);
+    virtual void printf(const char* format, ...);
+    virtual void printn(const char* text, int len);
+
+    virtual const std::string& input(int maxLength = -1, bool allowEscape = false, bool moveToNextLine = true);
+
+    virtual void locate(int row, int col);
+    virtual void color(int fg, int bg);
+
+    void flush();
+
+private:
+    static const int kBufferSize = 64 * 1024;
+
+    FILE* mOutput;
+    FILE* mInput;
+    char mBuffer[kBufferSize];
+    int mLength;
+    std::string mText;
+};
@@ -97,6 +97,12 @@ public:
         return alloc(count);
     }
 
+    void trim(int count)
+    {
+        assert(count >= 0 && count <= mSize);
+        mSize -= count;
+    }
+
 private:
     int mCapacity;
     int mSize;
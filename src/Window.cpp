@@ -35,7 +35,6 @@
 
 #include <SDL.h>
 
-#include "Font.h"
 #include "Window.h"
 
 Window::Window()
@@ -43,13 +42,18 @@ Window::Window()
     mWindow(nullptr),
     mScreen(nullptr),
     mCells(nullptr),
+    mDirtyCells(),
     mCursorRow(1),
     mCursorCol(1),
     mCursorVisible(false),
     mFg(7),
     mBg(0),
-    mDirty(true),
-    mPalette()
+    mPalette(),
+#ifdef ZB_GLYPH_ATLAS
+    mAtlas(),
+#endif
+    mInputText(),
+    mPendingKeys()
 {
     if (SDL_Init(SDL_INIT_VIDEO) == -1) {
         std::stringstream msg;
@@ -126,60 +130,145 @@ static int mapKey(int sym)
     return 0;
 }
 
-int Window::runOnce()
+int Window::translateEvent(const void* event, bool wakeable)
+{
+    auto evt = (const SDL_Event*)event;
+    switch (evt->type) {
+    case SDL_QUIT:
+        return QUIT;
+    case SDL_KEYDOWN:
+        // Ctrl+Break, or Ctrl+C on keyboards without a Break key
+        if (evt->key.keysym.sym == SDLK_CANCEL)
+            return BREAK;
+        if ((evt->key.keysym.mod & KMOD_CTRL) && (evt->key.keysym.sym == SDLK_PAUSE || evt->key.keysym.sym == SDLK_c))
+            return BREAK;
+        return mapKey(evt->key.keysym.sym);
+    case SDL_TEXTINPUT:
+        if (evt->text.text[0] >= 32 && evt->text.text[0] <= 126)
+            return evt->text.text[0];
+        return 0;
+    case SDL_USEREVENT:
+        return wakeable ? WAKE : 0;
+    default:
+        return 0;
+    }
+}
+
+int Window::runOnce(bool wakeable)
 {
     SDL_Event evt;
     int e = 0;
 
-    if (mDirty) {
-        SDL_UpdateWindowSurface((SDL_Window*)mWindow);
-        mDirty = 0;
+    present();
+
+    if (!mPendingKeys.empty()) {
+        e = mPendingKeys.front();
+        mPendingKeys.pop_front();
+        return e;
     }
 
-    while (e == 0 && SDL_WaitEvent(&evt)) {
-        switch (evt.type) {
-        case SDL_QUIT:
-            e = QUIT;
-            break;
-        case SDL_KEYDOWN:
-            e = mapKey(evt.key.keysym.sym);
-            break;
-        case SDL_TEXTINPUT:
-            if (evt.text.text[0] >= 32 && evt.text.text[0] <= 126)
-                e = evt.text.text[0];
-            break;
-        default:
-            break;
+    while (e == 0 && SDL_WaitEvent(&evt))
+        e = translateEvent(&evt, wakeable);
+
+    return e;
+}
+
+int Window::poll(int timeoutMs)
+{
+    // left by input, which gave up on the line
+    for (auto key = mPendingKeys.begin(); key != mPendingKeys.end(); ++key) {
+        if (*key == BREAK || *key == QUIT) {
+            int e = *key;
+            mPendingKeys.erase(key);
+            return e;
         }
     }
 
-    return e;
+    SDL_Event evt;
+    int received = timeoutMs > 0 ? SDL_WaitEventTimeout(&evt, timeoutMs) : SDL_PollEvent(&evt);
+    while (received) {
+        int e = translateEvent(&evt, false);
+        if (e == BREAK || e == QUIT)
+            return e;
+        if (e != 0)
+            mPendingKeys.push_back(e);
+        received = SDL_PollEvent(&evt);
+    }
+    return 0;
 }
 
-void Window::renderCell(char ch, int row, int col, int fg, int bg)
+void Window::present()
+{
+    if (mDirtyCells.none())
+        return;
+
+#ifndef ZB_GLYPH_ATLAS
+    uint32_t palette[kPaletteSize];
+    for (int ix = 0; ix < kPaletteSize; ++ix)
+        palette[ix] = mPalette[ix].getValue();
+#endif
+
+    SDL_Surface* screen = (SDL_Surface*)mScreen;
+    int pitch = screen->pitch / sizeof(Uint32);
+
+    // Each row is drawn in one pass from its first dirty cell to its last,
+    // and put on screen as one rectangle, merged with the row above when the
+    // spans match so a full redraw is a single rectangle.
+    SDL_Rect rects[25];
+    int count = 0;
+    for (int row = 1; row <= 25; ++row) {
+        int first = 0;
+        int last = 0;
+        for (int col = 1; col <= 80; ++col) {
+            if (mDirtyCells[((row - 1) * 80) + (col - 1)]) {
+                if (first == 0)
+                    first = col;
+                last = col;
+            }
+        }
+        if (first == 0)
+            continue;
+
+        Uint32* pixels = (Uint32*)screen->pixels + (((row - 1) * 16) * pitch) + ((first - 1) * 8);
+#ifdef ZB_GLYPH_ATLAS
+        mAtlas.drawCells(mCells + ((row - 1) * 80) + (first - 1), last - first + 1, pixels, pitch);
+#else
+        rasterizeCells(mCells + ((row - 1) * 80) + (first - 1), last - first + 1, palette, pixels, pitch);
+#endif
+        if (mCursorVisible && row == mCursorRow && mCursorCol >= first && mCursorCol <= last)
+            drawCursor();
+
+        SDL_Rect rect = { (first - 1) * 8, (row - 1) * 16, (last - first + 1) * 8, 16 };
+        SDL_Rect* above = count > 0 ? &rects[count - 1] : nullptr;
+        if (above && above->x == rect.x && above->w == rect.w && above->y + above->h == rect.y)
+            above->h += rect.h;
+        else
+            rects[count++] = rect;
+    }
+    mDirtyCells.reset();
+
+    SDL_UpdateWindowSurfaceRects((SDL_Window*)mWindow, rects, count);
+}
+
+void Window::wake()
+{
+    SDL_Event evt;
+    SDL_zero(evt);
+    evt.type = SDL_USEREVENT;
+    (void)SDL_PushEvent(&evt);
+}
+
+void Window::invalidate(int row, int col)
 {
     assert(row >= 1 && row <= 25);
     assert(col >= 1 && col <= 80);
-    assert(fg >= 0 && fg <= 15);
-    assert(bg >= 0 && bg <= 15);
 
-    Uint32 pitch = ((SDL_Surface*)mScreen)->pitch / sizeof(Uint32);
-    Uint32* pixel = (Uint32*)((SDL_Surface*)mScreen)->pixels + (((row - 1) * 16) * pitch) + ((col - 1) * 8);
-    uint8_t* chr = (uint8_t*)font8x16 + (ch * 16);
-    Uint32 colr[2] = { mPalette[bg].getValue(), mPalette[fg].getValue() };
-
-    for (int y = 0; y < 16; ++y) {
-        *(pixel) = colr[(*chr & 0x80) >> 7];
-        *(pixel + 1) = colr[(*chr & 0x40) >> 6];
-        *(pixel + 2) = colr[(*chr & 0x20) >> 5];
-        *(pixel + 3) = colr[(*chr & 0x10) >> 4];
-        *(pixel + 4) = colr[(*chr & 0x8) >> 3];
-        *(pixel + 5) = colr[(*chr & 0x4) >> 2];
-        *(pixel + 6) = colr[(*chr & 0x2) >> 1];
-        *(pixel + 7) = colr[*chr & 0x1];
-        ++chr;
-        pixel += pitch;
-    }
+    mDirtyCells.set(((row - 1) * 80) + (col - 1));
+}
+
+void Window::invalidateAll()
+{
+    mDirtyCells.set();
 }
 
 void Window::clear()
@@ -190,14 +279,11 @@ void Window::clear()
         for (int x = 0; x < 80; ++x) {
             mCells[(y * 80) + x].ch = 0;
             mCells[(y * 80) + x].color = (mBg << 4) | mFg;
-            renderCell(0, y + 1, x + 1, mFg, mBg);
         }
     }
     mCursorRow = 1;
     mCursorCol = 1;
-    if (mCursorVisible)
-        drawCursor();
-    mDirty = true;
+    invalidateAll();
 }
 
 void Window::scroll()
@@ -210,12 +296,7 @@ void Window::scroll()
         mCells[i].color = (mBg << 4) | mFg;
     }
 
-    for (int row = 1; row <= 25; ++row) {
-        for (int col = 1; col <= 80; ++col) {
-            Cell* cell = mCells + ((row - 1) * 80) + (col - 1);
-            renderCell(cell->ch, row, col, cell->color & 0xf, cell->color >> 4);
-        }
-    }
+    invalidateAll();
 }
 
 void Window::print(const char* text)
@@ -246,16 +327,9 @@ void Window::drawCursor()
     SDL_FillRect((SDL_Surface*)mScreen, &dst, mPalette[cell->color & 0xf].getValue());
 }
 
-void Window::eraseCursor()
-{
-    Cell* cell = mCells + ((mCursorRow - 1) * 80) + (mCursorCol - 1);
-    renderCell(cell->ch, mCursorRow, mCursorCol, cell->color & 0xf, cell->color >> 4);
-}
-
 void Window::printn(const char* text, int len)
 {
-    if (mCursorVisible)
-        eraseCursor();
+    invalidate(mCursorRow, mCursorCol);
 
     while (len > 0) {
         char ch = *text;
@@ -276,7 +350,7 @@ void Window::printn(const char* text, int len)
             Cell* cell = mCells + ((mCursorRow - 1) * 80) + (mCursorCol - 1);
             cell->ch = ch;
             cell->color = (mBg << 4) | mFg;
-            renderCell(ch, mCursorRow, mCursorCol, mFg, mBg);
+            invalidate(mCursorRow, mCursorCol);
 
             if (!(len == 0 && (mCursorRow == 25 && mCursorCol == 80))) {
                 ++mCursorCol;
@@ -292,16 +366,12 @@ void Window::printn(const char* text, int len)
         }
     }
 
-    if (mCursorVisible)
-        drawCursor();
-
-    mDirty = true;
+    invalidate(mCursorRow, mCursorCol);
 }
 
 const std::string& Window::input(int maxLength, bool allowEscape, bool moveToNextLine)
 {
-    static std::string text;
-    text.clear();
+    mInputText.clear();
 
     bool rehideCursor = false;
 
@@ -314,9 +384,16 @@ const std::string& Window::input(int maxLength, bool allowEscape, bool moveToNex
     while (!done) {
         int evt = runOnce();
         switch (evt) {
+        case BREAK:
+        case QUIT:
+            // leave it for whoever is running the program
+            mPendingKeys.push_back(evt);
+            mInputText.clear();
+            done = true;
+            break;
         case ESCAPE:
             if (allowEscape) {
-                text.clear();
+                mInputText.clear();
                 done = true;
             }
             break;
@@ -324,10 +401,10 @@ const std::string& Window::input(int maxLength, bool allowEscape, bool moveToNex
             done = true;
             break;
         case BACKSPACE:
-            if (!text.empty()) {
-                text.erase(text.length() - 1, 1);
+            if (!mInputText.empty()) {
+                mInputText.erase(mInputText.length() - 1, 1);
 
-                eraseCursor();
+                invalidate(mCursorRow, mCursorCol);
                 --mCursorCol;
                 if (mCursorCol < 1) {
                     mCursorCol = 80;
@@ -336,34 +413,28 @@ const std::string& Window::input(int maxLength, bool allowEscape, bool moveToNex
                 Cell* cell = mCells + ((mCursorRow - 1) * 80) + (mCursorCol - 1);
                 cell->ch = ' ';
                 cell->color = (mBg << 4) | mFg;
-                renderCell(' ', mCursorRow, mCursorCol, mFg, mBg);
-                drawCursor();
-
-                mDirty = true;
+                invalidate(mCursorRow, mCursorCol);
             }
             break;
         default:
             if (evt >= 32 && evt <= 126) {
-                if ((maxLength == -1 && text.length() < 255) || text.length() < maxLength - 1) {
-                    text.push_back((char)evt);
+                if ((maxLength == -1 && mInputText.length() < 255) || mInputText.length() < maxLength - 1) {
+                    mInputText.push_back((char)evt);
                     Cell* cell = mCells + ((mCursorRow - 1) * 80) + (mCursorCol - 1);
                     cell->ch = (char)evt;
                     cell->color = (mBg << 4) | mFg;
-                    renderCell((char)evt, mCursorRow, mCursorCol, mFg, mBg);
+                    invalidate(mCursorRow, mCursorCol);
 
                     ++mCursorCol;
                     if (mCursorCol > 80) {
                         mCursorCol = 1;
                         ++mCursorRow;
                         if (mCursorRow > 25) {
-                            eraseCursor();
+                            --mCursorRow;
                             scroll();
-                            drawCursor();
                         }
                     }
-                    drawCursor();
-
-                    mDirty = true;
+                    invalidate(mCursorRow, mCursorCol);
                 }
             }
             break;
@@ -384,7 +455,7 @@ const std::string& Window::input(int maxLength, bool allowEscape, bool moveToNex
     if (!rehideCursor)
         showCursor();
 
-    return text;
+    return mInputText;
 }
 
 void Window::locate(int row, int col)
@@ -398,16 +469,13 @@ void Window::locate(int row, int col)
     assert(col >= 1 && col <= 80);
 
     if (row != mCursorRow || col != mCursorCol) {
-        if (mCursorVisible)
-            eraseCursor();
+        if (mCursorVisible) {
+            invalidate(mCursorRow, mCursorCol);
+            invalidate(row, col);
+        }
 
         mCursorRow = row;
         mCursorCol = col;
-
-        if (mCursorVisible)
-            drawCursor();
-
-        mDirty = true;
     }
 }
 
@@ -428,18 +496,16 @@ void Window::color(int fg, int bg)
 void Window::showCursor()
 {
     if (!mCursorVisible) {
-        drawCursor();
         mCursorVisible = true;
-        mDirty = true;
+        invalidate(mCursorRow, mCursorCol);
     }
 }
 
 void Window::hideCursor()
 {
     if (mCursorVisible) {
-        eraseCursor();
         mCursorVisible = false;
-        mDirty = true;
+        invalidate(mCursorRow, mCursorCol);
     }
 }
 
@@ -452,4 +518,8 @@ void Window::getCursorLocation(int& row, int& col)
 void Window::setPalette(const Palette& palette)
 {
     mPalette = palette;
+#ifdef ZB_GLYPH_ATLAS
+    mAtlas.setPalette(palette);
+#endif
+    invalidateAll();
 }
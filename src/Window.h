@@ -30,8 +30,15 @@
 
 #pragma once
 
+#include <bitset>
 #include <cstdint>
+#include <deque>
 #include <string>
+#ifdef ZB_GLYPH_ATLAS
+#include "GlyphAtlas.h"
+#endif
+#include "GlyphRasterizer.h"
+#include "IConsole.h"
 #include "Palette.h"
 
 enum
@@ -62,27 +69,46 @@ enum
     F10,
     F11,
     F12,
+    WAKE,
+    BREAK,
     QUIT = 1024
 };
 
 class Window
+    :
+    public IConsole
 {
 public:
     Window();
-    ~Window();
+    virtual ~Window();
 
-    int runOnce();
+    // with wakeable, also returns WAKE when another thread calls wake()
+    int runOnce(bool wakeable = false);
+
+    // safe to call from any thread
+    void wake();
+
+    // Handles whatever events are waiting, for use while a program runs;
+    // with a timeout, waits up to that long for the first one.  Returns BREAK
+    // or QUIT if one came in; other keys are kept for runOnce in the order
+    // they were pressed.
+    int poll(int timeoutMs = 0);
+
+    // Draws the cells that changed since the last present and puts just
+    // those on screen.  Writes only update the cell grid, so any number of
+    // them between presents costs one frame.
+    void present();
 
     void clear();
 
-    void print(const char* text);
-    void printf(const char* format, ...);
-    void printn(const char* text, int len);
+    virtual void print(const char* text);
+    virtual void printf(const char* format, ...);
+    virtual void printn(const char* text, int len);
 
-    const std::string& input(int maxLength = -1, bool allowEscape = false, bool moveToNextLine = true);
+    virtual const std::string& input(int maxLength = -1, bool allowEscape = false, bool moveToNextLine = true);
 
-    void locate(int row, int col);
-    void color(int fg, int bg);
+    virtual void locate(int row, int col);
+    virtual void color(int fg, int bg);
 
     void showCursor();
     void hideCursor();
@@ -95,24 +121,31 @@ private:
     void* mWindow;
     void* mScreen;
 
-    struct Cell
-    {
-        char ch;
-        uint8_t color;
-    };
+    typedef GlyphCell Cell;
     Cell* mCells;
 
+    // cells written since the last present, row by row
+    std::bitset<80 * 25> mDirtyCells;
+
     int mCursorRow;
     int mCursorCol;
     bool mCursorVisible;
     int mFg;
     int mBg;
-    bool mDirty;
 
     Palette mPalette;
+#ifdef ZB_GLYPH_ATLAS
+    GlyphAtlas mAtlas;
+#endif
+
+    std::string mInputText;
+    std::deque<int> mPendingKeys;
+
+    int translateEvent(const void* event, bool wakeable);
+
+    void invalidate(int row, int col);
+    void invalidateAll();
 
-    void renderCell(char ch, int row, int col, int fg, int bg);
     void scroll();
     void drawCursor();
-    void eraseCursor();
 };
@@ -30,16 +30,26 @@
 
 #ifdef _WIN32
 #include <Windows.h>
-#else
-#include <cstdio>
 #endif
 
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 
+#include "BatchExecutor.h"
+#include "CompileCache.h"
 #include "CompileError.h"
 #include "Compiler.h"
+#include "CppEmitter.h"
 #include "Ide.h"
 #include "Interpreter.h"
+#include "ProgramImage.h"
+#include "SourceFile.h"
+#include "StdioConsole.h"
 #include "TextSourceStream.h"
 #include "Window.h"
 
@@ -53,8 +63,259 @@ void fatalError(const std::string& title, const std::string& message)
     exit(-1);
 }
 
+bool readFile(const std::string& filename, std::string& text)
+{
+    if (!readSourceFile(filename, text)) {
+        fprintf(stderr, "Failed to open file: %s\n", filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool parseDispatchMode(const char* text, DispatchMode& mode)
+{
+    static const struct
+    {
+        const char* name;
+        DispatchMode mode;
+    } modes[] = {
+        { "call", DispatchMode::Call },
+        { "threaded", DispatchMode::Threaded },
+        { "native", DispatchMode::Native },
+        { "tracing", DispatchMode::Tracing }
+    };
+
+    for (auto& entry : modes) {
+        if (strcmp(text, entry.name) == 0) {
+            mode = entry.mode;
+            return true;
+        }
+    }
+    return false;
+}
+
+void printCacheStatistics(const CompileCacheStatistics& statistics)
+{
+    fprintf(stderr, "cache: %llu hits, %llu misses, %llu stores, %llu evictions\n",
+        (unsigned long long)statistics.hits, (unsigned long long)statistics.misses,
+        (unsigned long long)statistics.stores, (unsigned long long)statistics.evictions);
+}
+
+bool isProgramImage(const std::string& filename)
+{
+    return filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".zbc") == 0;
+}
+
+// Runs a program against stdin/stdout without bringing up SDL.  When
+// profiling, the cost of each source line and opcode goes to stderr; when
+// sampling, stderr gets folded stacks for a flame graph.
+int runProgram(const Program& program, DispatchMode dispatchMode)
+{
+    StdioConsole console;
+    Interpreter interpreter(console, program, dispatchMode);
+    try {
+        interpreter.run();
+    }
+    catch (const std::runtime_error& error) {
+        console.flush();
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+
+    console.flush();
+    if (dispatchMode == DispatchMode::Profiling)
+        interpreter.getProfiler().report(stderr);
+    else if (dispatchMode == DispatchMode::Sampling)
+        interpreter.getSampler().writeFolded(stderr);
+    return 0;
+}
+
+int runSource(const std::string& filename, DispatchMode dispatchMode, CompileCache* cache)
+{
+    std::string code;
+    if (!readFile(filename, code))
+        return 1;
+
+    try {
+        Compiler compiler;
+        compiler.setCache(cache);
+        TextSourceStream stream(code.data(), (int)code.length());
+        return runProgram(compiler.run(stream), dispatchMode);
+    }
+    catch (const CompileError& error) {
+        fprintf(stderr, "%s\n", formatCompileError(filename, error).c_str());
+        return 1;
+    }
+}
+
+// Runs either BASIC source, which is compiled first unless the cache already
+// has it, or a compiled .zbc image, which is mapped and run in place.  With a
+// cache, its hits and misses go to stderr afterward.
+int runFile(const std::string& filename, DispatchMode dispatchMode, const std::string& cacheDirectory)
+{
+    if (isProgramImage(filename)) {
+        ProgramImage image;
+        std::string error;
+        if (!image.load(filename, error)) {
+            fprintf(stderr, "%s: %s\n", filename.c_str(), error.c_str());
+            return 1;
+        }
+        return runProgram(image.getProgram(), dispatchMode);
+    }
+
+    if (cacheDirectory.empty())
+        return runSource(filename, dispatchMode, nullptr);
+    CompileCache cache(cacheDirectory);
+    int result = runSource(filename, dispatchMode, &cache);
+    printCacheStatistics(cache.getStatistics());
+    return result;
+}
+
+// Compiles BASIC source to a .zbc image for `zb run`.
+int compileFile(const std::string& filename, const std::string& output)
+{
+    std::string code;
+    if (!readFile(filename, code))
+        return 1;
+
+    try {
+        Compiler compiler;
+        TextSourceStream stream(code.data(), (int)code.length());
+        auto program = compiler.run(stream);
+
+        std::string error;
+        if (!ProgramImage::save(program, code, output, error)) {
+            fprintf(stderr, "%s: %s\n", output.c_str(), error.c_str());
+            return 1;
+        }
+    }
+    catch (const CompileError& error) {
+        fprintf(stderr, "%s\n", formatCompileError(filename, error).c_str());
+        return 1;
+    }
+
+    return 0;
+}
+
+// Translates BASIC source to a C++ program that links against the runtime
+// library (make runtime).
+int emitCppFile(const std::string& filename, const std::string& output)
+{
+    std::string code;
+    if (!readFile(filename, code))
+        return 1;
+
+    try {
+        Compiler compiler;
+        TextSourceStream stream(code.data(), (int)code.length());
+        auto program = compiler.run(stream);
+        CppEmitter emitter(program);
+        std::string cpp = emitter.run();
+
+#ifdef _WIN32
+        FILE* file = nullptr;
+        (void)fopen_s(&file, output.c_str(), "wb");
+#else
+        FILE* file = fopen(output.c_str(), "wb");
+#endif
+        if (!file || fwrite(cpp.data(), 1, cpp.size(), file) != cpp.size()) {
+            fprintf(stderr, "Failed to write file: %s\n", output.c_str());
+            if (file)
+                fclose(file);
+            return 1;
+        }
+        fclose(file);
+    }
+    catch (const CompileError& error) {
+        fprintf(stderr, "%s\n", formatCompileError(filename, error).c_str());
+        return 1;
+    }
+
+    return 0;
+}
+
+// Runs programs in parallel, printing each one's output in the order given.
+int runBatch(const std::vector<std::string>& filenames, int threadCount, const std::string& cacheDirectory)
+{
+    std::vector<BatchJob> jobs(filenames.size());
+    for (size_t ix = 0; ix < filenames.size(); ++ix)
+        jobs[ix].filename = filenames[ix];
+
+    auto start = std::chrono::steady_clock::now();
+    BatchExecutor executor(threadCount, DispatchMode::Threaded, cacheDirectory);
+    executor.run(jobs);
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    int result = 0;
+    for (auto& job : jobs) {
+        if (!job.error.empty()) {
+            fprintf(stderr, "%s\n", job.error.c_str());
+            result = 1;
+            continue;
+        }
+        printf("==> %s <==\n", job.filename.c_str());
+        fwrite(job.output.data(), 1, job.output.size(), stdout);
+    }
+    fprintf(stderr, "%d programs on %d threads in %.1f ms\n", (int)jobs.size(), executor.getThreadCount(), elapsedMs);
+    if (!cacheDirectory.empty())
+        printCacheStatistics(executor.getCacheStatistics());
+    return result;
+}
+
 int main(int argc, char* argv[])
 {
+    // zb run [--profile | --sample | --dispatch <mode>] [--cache <dir>] <file.bas | file.zbc>
+    if (argc >= 3 && strcmp(argv[1], "run") == 0) {
+        DispatchMode dispatchMode = DispatchMode::Threaded;
+        std::string cacheDirectory;
+        int ix = 2;
+        for (; ix < argc - 1; ++ix) {
+            if (strcmp(argv[ix], "--profile") == 0)
+                dispatchMode = DispatchMode::Profiling;
+            else if (strcmp(argv[ix], "--sample") == 0)
+                dispatchMode = DispatchMode::Sampling;
+            else if (strcmp(argv[ix], "--dispatch") == 0 && ix + 2 < argc && parseDispatchMode(argv[ix + 1], dispatchMode))
+                ++ix;
+            else if (strcmp(argv[ix], "--cache") == 0 && ix + 2 < argc)
+                cacheDirectory = argv[++ix];
+            else
+                break;
+        }
+        if (ix != argc - 1) {
+            fprintf(stderr, "usage: zb run [--profile | --sample | --dispatch call|threaded|native|tracing] [--cache <dir>] <file.bas | file.zbc>\n");
+            return 1;
+        }
+        return runFile(argv[ix], dispatchMode, cacheDirectory);
+    }
+
+    // zb compile <file.bas> <file.zbc>
+    if (argc == 4 && strcmp(argv[1], "compile") == 0)
+        return compileFile(argv[2], argv[3]);
+
+    // zb emit-cpp <file.bas> <file.cpp>
+    if (argc == 4 && strcmp(argv[1], "emit-cpp") == 0)
+        return emitCppFile(argv[2], argv[3]);
+
+    // zb batch [--jobs N] [--cache <dir>] <file.bas>...
+    if (argc >= 3 && strcmp(argv[1], "batch") == 0) {
+        int threadCount = 0;
+        std::string cacheDirectory;
+        std::vector<std::string> filenames;
+        for (int ix = 2; ix < argc; ++ix) {
+            if (strcmp(argv[ix], "--jobs") == 0 && ix + 1 < argc)
+                threadCount = atoi(argv[++ix]);
+            else if (strcmp(argv[ix], "--cache") == 0 && ix + 1 < argc)
+                cacheDirectory = argv[++ix];
+            else
+                filenames.push_back(argv[ix]);
+        }
+        if (filenames.empty() || threadCount < 0) {
+            fprintf(stderr, "usage: zb batch [--jobs N] [--cache <dir>] <file.bas>...\n");
+            return 1;
+        }
+        return runBatch(filenames, threadCount, cacheDirectory);
+    }
+
     std::string filename;
     if (argc == 2)
         filename = argv[1];
@@ -0,0 +1,45 @@
+#!/bin/sh
+# Runs every program in tests/programs through zb and compares its output
+# with the .out file next to it, then checks that the other back-ends print
+# the same as the call-dispatch interpreter for those programs and the
+# benchmark corpus.  With the runtime library, each program is also
+# translated by zb emit-cpp, built with $CXX and run.
+#
+#     tests/check.sh [path/to/zb [path/to/libzbrt.a]]
+
+ZB=${1:-./zb}
+RUNTIME=$2
+CXX=${CXX:-c++}
+failed=0
+scratch=$(mktemp -d)
+trap 'rm -rf "$scratch"' EXIT
+
+fail()
+{
+    echo "FAIL: $*"
+    failed=1
+}
+
+for program in tests/programs/*.bas; do
+    expected="${program%.bas}.out"
+    "$ZB" run "$program" < /dev/null | cmp -s - "$expected" || fail "$program"
+done
+
+for program in bench/programs/*.bas tests/programs/*.bas; do
+    "$ZB" run --dispatch call "$program" < /dev/null > "$scratch/expected"
+    for mode in threaded native tracing; do
+        "$ZB" run --dispatch $mode "$program" < /dev/null | cmp -s - "$scratch/expected" || fail "$program (--dispatch $mode)"
+    done
+
+    if [ -n "$RUNTIME" ]; then
+        if "$ZB" emit-cpp "$program" "$scratch/program.cpp" &&
+           $CXX -O1 -I src -I src/Interpreter -o "$scratch/program" "$scratch/program.cpp" "$RUNTIME"; then
+            "$scratch/program" < /dev/null | cmp -s - "$scratch/expected" || fail "$program (emit-cpp)"
+        else
+            fail "$program (emit-cpp didn't build)"
+        fi
+    fi
+done
+
+[ $failed -eq 0 ] && echo "All tests passed"
+exit $failed
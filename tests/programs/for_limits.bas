@@ -0,0 +1,51 @@
+DIM I AS INTEGER
+DIM N AS INTEGER
+
+N = 0
+FOR I = 9223372036854775806 TO 9223372036854775807
+    PRINT I
+    N = N + 1
+NEXT I
+PRINT "up: "; N; " "; I
+
+N = 0
+FOR I = -9223372036854775807 - 1 TO -9223372036854775807 + 1
+    N = N + 1
+NEXT I
+PRINT "start at min: "; N; " "; I
+
+N = 0
+FOR I = -9223372036854775806 TO -9223372036854775807 - 1 STEP -1
+    N = N + 1
+NEXT I
+PRINT "down: "; N; " "; I
+
+N = 0
+FOR I = 0 TO 9223372036854775807 STEP 4611686018427387904
+    N = N + 1
+NEXT I
+PRINT "big step: "; N; " "; I
+
+N = 0
+FOR I = 5 TO 1
+    N = N + 1
+NEXT I
+PRINT "empty: "; N; " "; I
+
+N = 0
+FOR I = 1 TO 5 STEP -1
+    N = N + 1
+NEXT I
+PRINT "empty down: "; N; " "; I
+
+N = 0
+FOR I = 1 TO 10 STEP 3
+    N = N + 1
+NEXT I
+PRINT "after: "; N; " "; I
+
+N = 0
+FOR I = 9223372036854775807 - 99999 TO 9223372036854775807
+    N = N + 1
+NEXT I
+PRINT "hot: "; N; " "; I
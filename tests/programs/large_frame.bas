@@ -0,0 +1,4511 @@
+DIM V1 AS INTEGER
+DIM V2 AS INTEGER
+DIM V3 AS INTEGER
+DIM V4 AS INTEGER
+DIM V5 AS INTEGER
+DIM V6 AS INTEGER
+DIM V7 AS INTEGER
+DIM V8 AS INTEGER
+DIM V9 AS INTEGER
+DIM V10 AS INTEGER
+DIM V11 AS INTEGER
+DIM V12 AS INTEGER
+DIM V13 AS INTEGER
+DIM V14 AS INTEGER
+DIM V15 AS INTEGER
+DIM V16 AS INTEGER
+DIM V17 AS INTEGER
+DIM V18 AS INTEGER
+DIM V19 AS INTEGER
+DIM V20 AS INTEGER
+DIM V21 AS INTEGER
+DIM V22 AS INTEGER
+DIM V23 AS INTEGER
+DIM V24 AS INTEGER
+DIM V25 AS INTEGER
+DIM V26 AS INTEGER
+DIM V27 AS INTEGER
+DIM V28 AS INTEGER
+DIM V29 AS INTEGER
+DIM V30 AS INTEGER
+DIM V31 AS INTEGER
+DIM V32 AS INTEGER
+DIM V33 AS INTEGER
+DIM V34 AS INTEGER
+DIM V35 AS INTEGER
+DIM V36 AS INTEGER
+DIM V37 AS INTEGER
+DIM V38 AS INTEGER
+DIM V39 AS INTEGER
+DIM V40 AS INTEGER
+DIM V41 AS INTEGER
+DIM V42 AS INTEGER
+DIM V43 AS INTEGER
+DIM V44 AS INTEGER
+DIM V45 AS INTEGER
+DIM V46 AS INTEGER
+DIM V47 AS INTEGER
+DIM V48 AS INTEGER
+DIM V49 AS INTEGER
+DIM V50 AS INTEGER
+DIM V51 AS INTEGER
+DIM V52 AS INTEGER
+DIM V53 AS INTEGER
+DIM V54 AS INTEGER
+DIM V55 AS INTEGER
+DIM V56 AS INTEGER
+DIM V57 AS INTEGER
+DIM V58 AS INTEGER
+DIM V59 AS INTEGER
+DIM V60 AS INTEGER
+DIM V61 AS INTEGER
+DIM V62 AS INTEGER
+DIM V63 AS INTEGER
+DIM V64 AS INTEGER
+DIM V65 AS INTEGER
+DIM V66 AS INTEGER
+DIM V67 AS INTEGER
+DIM V68 AS INTEGER
+DIM V69 AS INTEGER
+DIM V70 AS INTEGER
+DIM V71 AS INTEGER
+DIM V72 AS INTEGER
+DIM V73 AS INTEGER
+DIM V74 AS INTEGER
+DIM V75 AS INTEGER
+DIM V76 AS INTEGER
+DIM V77 AS INTEGER
+DIM V78 AS INTEGER
+DIM V79 AS INTEGER
+DIM V80 AS INTEGER
+DIM V81 AS INTEGER
+DIM V82 AS INTEGER
+DIM V83 AS INTEGER
+DIM V84 AS INTEGER
+DIM V85 AS INTEGER
+DIM V86 AS INTEGER
+DIM V87 AS INTEGER
+DIM V88 AS INTEGER
+DIM V89 AS INTEGER
+DIM V90 AS INTEGER
+DIM V91 AS INTEGER
+DIM V92 AS INTEGER
+DIM V93 AS INTEGER
+DIM V94 AS INTEGER
+DIM V95 AS INTEGER
+DIM V96 AS INTEGER
+DIM V97 AS INTEGER
+DIM V98 AS INTEGER
+DIM V99 AS INTEGER
+DIM V100 AS INTEGER
+DIM V101 AS INTEGER
+DIM V102 AS INTEGER
+DIM V103 AS INTEGER
+DIM V104 AS INTEGER
+DIM V105 AS INTEGER
+DIM V106 AS INTEGER
+DIM V107 AS INTEGER
+DIM V108 AS INTEGER
+DIM V109 AS INTEGER
+DIM V110 AS INTEGER
+DIM V111 AS INTEGER
+DIM V112 AS INTEGER
+DIM V113 AS INTEGER
+DIM V114 AS INTEGER
+DIM V115 AS INTEGER
+DIM V116 AS INTEGER
+DIM V117 AS INTEGER
+DIM V118 AS INTEGER
+DIM V119 AS INTEGER
+DIM V120 AS INTEGER
+DIM V121 AS INTEGER
+DIM V122 AS INTEGER
+DIM V123 AS INTEGER
+DIM V124 AS INTEGER
+DIM V125 AS INTEGER
+DIM V126 AS INTEGER
+DIM V127 AS INTEGER
+DIM V128 AS INTEGER
+DIM V129 AS INTEGER
+DIM V130 AS INTEGER
+DIM V131 AS INTEGER
+DIM V132 AS INTEGER
+DIM V133 AS INTEGER
+DIM V134 AS INTEGER
+DIM V135 AS INTEGER
+DIM V136 AS INTEGER
+DIM V137 AS INTEGER
+DIM V138 AS INTEGER
+DIM V139 AS INTEGER
+DIM V140 AS INTEGER
+DIM V141 AS INTEGER
+DIM V142 AS INTEGER
+DIM V143 AS INTEGER
+DIM V144 AS INTEGER
+DIM V145 AS INTEGER
+DIM V146 AS INTEGER
+DIM V147 AS INTEGER
+DIM V148 AS INTEGER
+DIM V149 AS INTEGER
+DIM V150 AS INTEGER
+DIM V151 AS INTEGER
+DIM V152 AS INTEGER
+DIM V153 AS INTEGER
+DIM V154 AS INTEGER
+DIM V155 AS INTEGER
+DIM V156 AS INTEGER
+DIM V157 AS INTEGER
+DIM V158 AS INTEGER
+DIM V159 AS INTEGER
+DIM V160 AS INTEGER
+DIM V161 AS INTEGER
+DIM V162 AS INTEGER
+DIM V163 AS INTEGER
+DIM V164 AS INTEGER
+DIM V165 AS INTEGER
+DIM V166 AS INTEGER
+DIM V167 AS INTEGER
+DIM V168 AS INTEGER
+DIM V169 AS INTEGER
+DIM V170 AS INTEGER
+DIM V171 AS INTEGER
+DIM V172 AS INTEGER
+DIM V173 AS INTEGER
+DIM V174 AS INTEGER
+DIM V175 AS INTEGER
+DIM V176 AS INTEGER
+DIM V177 AS INTEGER
+DIM V178 AS INTEGER
+DIM V179 AS INTEGER
+DIM V180 AS INTEGER
+DIM V181 AS INTEGER
+DIM V182 AS INTEGER
+DIM V183 AS INTEGER
+DIM V184 AS INTEGER
+DIM V185 AS INTEGER
+DIM V186 AS INTEGER
+DIM V187 AS INTEGER
+DIM V188 AS INTEGER
+DIM V189 AS INTEGER
+DIM V190 AS INTEGER
+DIM V191 AS INTEGER
+DIM V192 AS INTEGER
+DIM V193 AS INTEGER
+DIM V194 AS INTEGER
+DIM V195 AS INTEGER
+DIM V196 AS INTEGER
+DIM V197 AS INTEGER
+DIM V198 AS INTEGER
+DIM V199 AS INTEGER
+DIM V200 AS INTEGER
+DIM V201 AS INTEGER
+DIM V202 AS INTEGER
+DIM V203 AS INTEGER
+DIM V204 AS INTEGER
+DIM V205 AS INTEGER
+DIM V206 AS INTEGER
+DIM V207 AS INTEGER
+DIM V208 AS INTEGER
+DIM V209 AS INTEGER
+DIM V210 AS INTEGER
+DIM V211 AS INTEGER
+DIM V212 AS INTEGER
+DIM V213 AS INTEGER
+DIM V214 AS INTEGER
+DIM V215 AS INTEGER
+DIM V216 AS INTEGER
+DIM V217 AS INTEGER
+DIM V218 AS INTEGER
+DIM V219 AS INTEGER
+DIM V220 AS INTEGER
+DIM V221 AS INTEGER
+DIM V222 AS INTEGER
+DIM V223 AS INTEGER
+DIM V224 AS INTEGER
+DIM V225 AS INTEGER
+DIM V226 AS INTEGER
+DIM V227 AS INTEGER
+DIM V228 AS INTEGER
+DIM V229 AS INTEGER
+DIM V230 AS INTEGER
+DIM V231 AS INTEGER
+DIM V232 AS INTEGER
+DIM V233 AS INTEGER
+DIM V234 AS INTEGER
+DIM V235 AS INTEGER
+DIM V236 AS INTEGER
+DIM V237 AS INTEGER
+DIM V238 AS INTEGER
+DIM V239 AS INTEGER
+DIM V240 AS INTEGER
+DIM V241 AS INTEGER
+DIM V242 AS INTEGER
+DIM V243 AS INTEGER
+DIM V244 AS INTEGER
+DIM V245 AS INTEGER
+DIM V246 AS INTEGER
+DIM V247 AS INTEGER
+DIM V248 AS INTEGER
+DIM V249 AS INTEGER
+DIM V250 AS INTEGER
+DIM V251 AS INTEGER
+DIM V252 AS INTEGER
+DIM V253 AS INTEGER
+DIM V254 AS INTEGER
+DIM V255 AS INTEGER
+DIM V256 AS INTEGER
+DIM V257 AS INTEGER
+DIM V258 AS INTEGER
+DIM V259 AS INTEGER
+DIM V260 AS INTEGER
+DIM V261 AS INTEGER
+DIM V262 AS INTEGER
+DIM V263 AS INTEGER
+DIM V264 AS INTEGER
+DIM V265 AS INTEGER
+DIM V266 AS INTEGER
+DIM V267 AS INTEGER
+DIM V268 AS INTEGER
+DIM V269 AS INTEGER
+DIM V270 AS INTEGER
+DIM V271 AS INTEGER
+DIM V272 AS INTEGER
+DIM V273 AS INTEGER
+DIM V274 AS INTEGER
+DIM V275 AS INTEGER
+DIM V276 AS INTEGER
+DIM V277 AS INTEGER
+DIM V278 AS INTEGER
+DIM V279 AS INTEGER
+DIM V280 AS INTEGER
+DIM V281 AS INTEGER
+DIM V282 AS INTEGER
+DIM V283 AS INTEGER
+DIM V284 AS INTEGER
+DIM V285 AS INTEGER
+DIM V286 AS INTEGER
+DIM V287 AS INTEGER
+DIM V288 AS INTEGER
+DIM V289 AS INTEGER
+DIM V290 AS INTEGER
+DIM V291 AS INTEGER
+DIM V292 AS INTEGER
+DIM V293 AS INTEGER
+DIM V294 AS INTEGER
+DIM V295 AS INTEGER
+DIM V296 AS INTEGER
+DIM V297 AS INTEGER
+DIM V298 AS INTEGER
+DIM V299 AS INTEGER
+DIM V300 AS INTEGER
+DIM V301 AS INTEGER
+DIM V302 AS INTEGER
+DIM V303 AS INTEGER
+DIM V304 AS INTEGER
+DIM V305 AS INTEGER
+DIM V306 AS INTEGER
+DIM V307 AS INTEGER
+DIM V308 AS INTEGER
+DIM V309 AS INTEGER
+DIM V310 AS INTEGER
+DIM V311 AS INTEGER
+DIM V312 AS INTEGER
+DIM V313 AS INTEGER
+DIM V314 AS INTEGER
+DIM V315 AS INTEGER
+DIM V316 AS INTEGER
+DIM V317 AS INTEGER
+DIM V318 AS INTEGER
+DIM V319 AS INTEGER
+DIM V320 AS INTEGER
+DIM V321 AS INTEGER
+DIM V322 AS INTEGER
+DIM V323 AS INTEGER
+DIM V324 AS INTEGER
+DIM V325 AS INTEGER
+DIM V326 AS INTEGER
+DIM V327 AS INTEGER
+DIM V328 AS INTEGER
+DIM V329 AS INTEGER
+DIM V330 AS INTEGER
+DIM V331 AS INTEGER
+DIM V332 AS INTEGER
+DIM V333 AS INTEGER
+DIM V334 AS INTEGER
+DIM V335 AS INTEGER
+DIM V336 AS INTEGER
+DIM V337 AS INTEGER
+DIM V338 AS INTEGER
+DIM V339 AS INTEGER
+DIM V340 AS INTEGER
+DIM V341 AS INTEGER
+DIM V342 AS INTEGER
+DIM V343 AS INTEGER
+DIM V344 AS INTEGER
+DIM V345 AS INTEGER
+DIM V346 AS INTEGER
+DIM V347 AS INTEGER
+DIM V348 AS INTEGER
+DIM V349 AS INTEGER
+DIM V350 AS INTEGER
+DIM V351 AS INTEGER
+DIM V352 AS INTEGER
+DIM V353 AS INTEGER
+DIM V354 AS INTEGER
+DIM V355 AS INTEGER
+DIM V356 AS INTEGER
+DIM V357 AS INTEGER
+DIM V358 AS INTEGER
+DIM V359 AS INTEGER
+DIM V360 AS INTEGER
+DIM V361 AS INTEGER
+DIM V362 AS INTEGER
+DIM V363 AS INTEGER
+DIM V364 AS INTEGER
+DIM V365 AS INTEGER
+DIM V366 AS INTEGER
+DIM V367 AS INTEGER
+DIM V368 AS INTEGER
+DIM V369 AS INTEGER
+DIM V370 AS INTEGER
+DIM V371 AS INTEGER
+DIM V372 AS INTEGER
+DIM V373 AS INTEGER
+DIM V374 AS INTEGER
+DIM V375 AS INTEGER
+DIM V376 AS INTEGER
+DIM V377 AS INTEGER
+DIM V378 AS INTEGER
+DIM V379 AS INTEGER
+DIM V380 AS INTEGER
+DIM V381 AS INTEGER
+DIM V382 AS INTEGER
+DIM V383 AS INTEGER
+DIM V384 AS INTEGER
+DIM V385 AS INTEGER
+DIM V386 AS INTEGER
+DIM V387 AS INTEGER
+DIM V388 AS INTEGER
+DIM V389 AS INTEGER
+DIM V390 AS INTEGER
+DIM V391 AS INTEGER
+DIM V392 AS INTEGER
+DIM V393 AS INTEGER
+DIM V394 AS INTEGER
+DIM V395 AS INTEGER
+DIM V396 AS INTEGER
+DIM V397 AS INTEGER
+DIM V398 AS INTEGER
+DIM V399 AS INTEGER
+DIM V400 AS INTEGER
+DIM V401 AS INTEGER
+DIM V402 AS INTEGER
+DIM V403 AS INTEGER
+DIM V404 AS INTEGER
+DIM V405 AS INTEGER
+DIM V406 AS INTEGER
+DIM V407 AS INTEGER
+DIM V408 AS INTEGER
+DIM V409 AS INTEGER
+DIM V410 AS INTEGER
+DIM V411 AS INTEGER
+DIM V412 AS INTEGER
+DIM V413 AS INTEGER
+DIM V414 AS INTEGER
+DIM V415 AS INTEGER
+DIM V416 AS INTEGER
+DIM V417 AS INTEGER
+DIM V418 AS INTEGER
+DIM V419 AS INTEGER
+DIM V420 AS INTEGER
+DIM V421 AS INTEGER
+DIM V422 AS INTEGER
+DIM V423 AS INTEGER
+DIM V424 AS INTEGER
+DIM V425 AS INTEGER
+DIM V426 AS INTEGER
+DIM V427 AS INTEGER
+DIM V428 AS INTEGER
+DIM V429 AS INTEGER
+DIM V430 AS INTEGER
+DIM V431 AS INTEGER
+DIM V432 AS INTEGER
+DIM V433 AS INTEGER
+DIM V434 AS INTEGER
+DIM V435 AS INTEGER
+DIM V436 AS INTEGER
+DIM V437 AS INTEGER
+DIM V438 AS INTEGER
+DIM V439 AS INTEGER
+DIM V440 AS INTEGER
+DIM V441 AS INTEGER
+DIM V442 AS INTEGER
+DIM V443 AS INTEGER
+DIM V444 AS INTEGER
+DIM V445 AS INTEGER
+DIM V446 AS INTEGER
+DIM V447 AS INTEGER
+DIM V448 AS INTEGER
+DIM V449 AS INTEGER
+DIM V450 AS INTEGER
+DIM V451 AS INTEGER
+DIM V452 AS INTEGER
+DIM V453 AS INTEGER
+DIM V454 AS INTEGER
+DIM V455 AS INTEGER
+DIM V456 AS INTEGER
+DIM V457 AS INTEGER
+DIM V458 AS INTEGER
+DIM V459 AS INTEGER
+DIM V460 AS INTEGER
+DIM V461 AS INTEGER
+DIM V462 AS INTEGER
+DIM V463 AS INTEGER
+DIM V464 AS INTEGER
+DIM V465 AS INTEGER
+DIM V466 AS INTEGER
+DIM V467 AS INTEGER
+DIM V468 AS INTEGER
+DIM V469 AS INTEGER
+DIM V470 AS INTEGER
+DIM V471 AS INTEGER
+DIM V472 AS INTEGER
+DIM V473 AS INTEGER
+DIM V474 AS INTEGER
+DIM V475 AS INTEGER
+DIM V476 AS INTEGER
+DIM V477 AS INTEGER
+DIM V478 AS INTEGER
+DIM V479 AS INTEGER
+DIM V480 AS INTEGER
+DIM V481 AS INTEGER
+DIM V482 AS INTEGER
+DIM V483 AS INTEGER
+DIM V484 AS INTEGER
+DIM V485 AS INTEGER
+DIM V486 AS INTEGER
+DIM V487 AS INTEGER
+DIM V488 AS INTEGER
+DIM V489 AS INTEGER
+DIM V490 AS INTEGER
+DIM V491 AS INTEGER
+DIM V492 AS INTEGER
+DIM V493 AS INTEGER
+DIM V494 AS INTEGER
+DIM V495 AS INTEGER
+DIM V496 AS INTEGER
+DIM V497 AS INTEGER
+DIM V498 AS INTEGER
+DIM V499 AS INTEGER
+DIM V500 AS INTEGER
+DIM V501 AS INTEGER
+DIM V502 AS INTEGER
+DIM V503 AS INTEGER
+DIM V504 AS INTEGER
+DIM V505 AS INTEGER
+DIM V506 AS INTEGER
+DIM V507 AS INTEGER
+DIM V508 AS INTEGER
+DIM V509 AS INTEGER
+DIM V510 AS INTEGER
+DIM V511 AS INTEGER
+DIM V512 AS INTEGER
+DIM V513 AS INTEGER
+DIM V514 AS INTEGER
+DIM V515 AS INTEGER
+DIM V516 AS INTEGER
+DIM V517 AS INTEGER
+DIM V518 AS INTEGER
+DIM V519 AS INTEGER
+DIM V520 AS INTEGER
+DIM V521 AS INTEGER
+DIM V522 AS INTEGER
+DIM V523 AS INTEGER
+DIM V524 AS INTEGER
+DIM V525 AS INTEGER
+DIM V526 AS INTEGER
+DIM V527 AS INTEGER
+DIM V528 AS INTEGER
+DIM V529 AS INTEGER
+DIM V530 AS INTEGER
+DIM V531 AS INTEGER
+DIM V532 AS INTEGER
+DIM V533 AS INTEGER
+DIM V534 AS INTEGER
+DIM V535 AS INTEGER
+DIM V536 AS INTEGER
+DIM V537 AS INTEGER
+DIM V538 AS INTEGER
+DIM V539 AS INTEGER
+DIM V540 AS INTEGER
+DIM V541 AS INTEGER
+DIM V542 AS INTEGER
+DIM V543 AS INTEGER
+DIM V544 AS INTEGER
+DIM V545 AS INTEGER
+DIM V546 AS INTEGER
+DIM V547 AS INTEGER
+DIM V548 AS INTEGER
+DIM V549 AS INTEGER
+DIM V550 AS INTEGER
+DIM V551 AS INTEGER
+DIM V552 AS INTEGER
+DIM V553 AS INTEGER
+DIM V554 AS INTEGER
+DIM V555 AS INTEGER
+DIM V556 AS INTEGER
+DIM V557 AS INTEGER
+DIM V558 AS INTEGER
+DIM V559 AS INTEGER
+DIM V560 AS INTEGER
+DIM V561 AS INTEGER
+DIM V562 AS INTEGER
+DIM V563 AS INTEGER
+DIM V564 AS INTEGER
+DIM V565 AS INTEGER
+DIM V566 AS INTEGER
+DIM V567 AS INTEGER
+DIM V568 AS INTEGER
+DIM V569 AS INTEGER
+DIM V570 AS INTEGER
+DIM V571 AS INTEGER
+DIM V572 AS INTEGER
+DIM V573 AS INTEGER
+DIM V574 AS INTEGER
+DIM V575 AS INTEGER
+DIM V576 AS INTEGER
+DIM V577 AS INTEGER
+DIM V578 AS INTEGER
+DIM V579 AS INTEGER
+DIM V580 AS INTEGER
+DIM V581 AS INTEGER
+DIM V582 AS INTEGER
+DIM V583 AS INTEGER
+DIM V584 AS INTEGER
+DIM V585 AS INTEGER
+DIM V586 AS INTEGER
+DIM V587 AS INTEGER
+DIM V588 AS INTEGER
+DIM V589 AS INTEGER
+DIM V590 AS INTEGER
+DIM V591 AS INTEGER
+DIM V592 AS INTEGER
+DIM V593 AS INTEGER
+DIM V594 AS INTEGER
+DIM V595 AS INTEGER
+DIM V596 AS INTEGER
+DIM V597 AS INTEGER
+DIM V598 AS INTEGER
+DIM V599 AS INTEGER
+DIM V600 AS INTEGER
+DIM V601 AS INTEGER
+DIM V602 AS INTEGER
+DIM V603 AS INTEGER
+DIM V604 AS INTEGER
+DIM V605 AS INTEGER
+DIM V606 AS INTEGER
+DIM V607 AS INTEGER
+DIM V608 AS INTEGER
+DIM V609 AS INTEGER
+DIM V610 AS INTEGER
+DIM V611 AS INTEGER
+DIM V612 AS INTEGER
+DIM V613 AS INTEGER
+DIM V614 AS INTEGER
+DIM V615 AS INTEGER
+DIM V616 AS INTEGER
+DIM V617 AS INTEGER
+DIM V618 AS INTEGER
+DIM V619 AS INTEGER
+DIM V620 AS INTEGER
+DIM V621 AS INTEGER
+DIM V622 AS INTEGER
+DIM V623 AS INTEGER
+DIM V624 AS INTEGER
+DIM V625 AS INTEGER
+DIM V626 AS INTEGER
+DIM V627 AS INTEGER
+DIM V628 AS INTEGER
+DIM V629 AS INTEGER
+DIM V630 AS INTEGER
+DIM V631 AS INTEGER
+DIM V632 AS INTEGER
+DIM V633 AS INTEGER
+DIM V634 AS INTEGER
+DIM V635 AS INTEGER
+DIM V636 AS INTEGER
+DIM V637 AS INTEGER
+DIM V638 AS INTEGER
+DIM V639 AS INTEGER
+DIM V640 AS INTEGER
+DIM V641 AS INTEGER
+DIM V642 AS INTEGER
+DIM V643 AS INTEGER
+DIM V644 AS INTEGER
+DIM V645 AS INTEGER
+DIM V646 AS INTEGER
+DIM V647 AS INTEGER
+DIM V648 AS INTEGER
+DIM V649 AS INTEGER
+DIM V650 AS INTEGER
+DIM V651 AS INTEGER
+DIM V652 AS INTEGER
+DIM V653 AS INTEGER
+DIM V654 AS INTEGER
+DIM V655 AS INTEGER
+DIM V656 AS INTEGER
+DIM V657 AS INTEGER
+DIM V658 AS INTEGER
+DIM V659 AS INTEGER
+DIM V660 AS INTEGER
+DIM V661 AS INTEGER
+DIM V662 AS INTEGER
+DIM V663 AS INTEGER
+DIM V664 AS INTEGER
+DIM V665 AS INTEGER
+DIM V666 AS INTEGER
+DIM V667 AS INTEGER
+DIM V668 AS INTEGER
+DIM V669 AS INTEGER
+DIM V670 AS INTEGER
+DIM V671 AS INTEGER
+DIM V672 AS INTEGER
+DIM V673 AS INTEGER
+DIM V674 AS INTEGER
+DIM V675 AS INTEGER
+DIM V676 AS INTEGER
+DIM V677 AS INTEGER
+DIM V678 AS INTEGER
+DIM V679 AS INTEGER
+DIM V680 AS INTEGER
+DIM V681 AS INTEGER
+DIM V682 AS INTEGER
+DIM V683 AS INTEGER
+DIM V684 AS INTEGER
+DIM V685 AS INTEGER
+DIM V686 AS INTEGER
+DIM V687 AS INTEGER
+DIM V688 AS INTEGER
+DIM V689 AS INTEGER
+DIM V690 AS INTEGER
+DIM V691 AS INTEGER
+DIM V692 AS INTEGER
+DIM V693 AS INTEGER
+DIM V694 AS INTEGER
+DIM V695 AS INTEGER
+DIM V696 AS INTEGER
+DIM V697 AS INTEGER
+DIM V698 AS INTEGER
+DIM V699 AS INTEGER
+DIM V700 AS INTEGER
+DIM V701 AS INTEGER
+DIM V702 AS INTEGER
+DIM V703 AS INTEGER
+DIM V704 AS INTEGER
+DIM V705 AS INTEGER
+DIM V706 AS INTEGER
+DIM V707 AS INTEGER
+DIM V708 AS INTEGER
+DIM V709 AS INTEGER
+DIM V710 AS INTEGER
+DIM V711 AS INTEGER
+DIM V712 AS INTEGER
+DIM V713 AS INTEGER
+DIM V714 AS INTEGER
+DIM V715 AS INTEGER
+DIM V716 AS INTEGER
+DIM V717 AS INTEGER
+DIM V718 AS INTEGER
+DIM V719 AS INTEGER
+DIM V720 AS INTEGER
+DIM V721 AS INTEGER
+DIM V722 AS INTEGER
+DIM V723 AS INTEGER
+DIM V724 AS INTEGER
+DIM V725 AS INTEGER
+DIM V726 AS INTEGER
+DIM V727 AS INTEGER
+DIM V728 AS INTEGER
+DIM V729 AS INTEGER
+DIM V730 AS INTEGER
+DIM V731 AS INTEGER
+DIM V732 AS INTEGER
+DIM V733 AS INTEGER
+DIM V734 AS INTEGER
+DIM V735 AS INTEGER
+DIM V736 AS INTEGER
+DIM V737 AS INTEGER
+DIM V738 AS INTEGER
+DIM V739 AS INTEGER
+DIM V740 AS INTEGER
+DIM V741 AS INTEGER
+DIM V742 AS INTEGER
+DIM V743 AS INTEGER
+DIM V744 AS INTEGER
+DIM V745 AS INTEGER
+DIM V746 AS INTEGER
+DIM V747 AS INTEGER
+DIM V748 AS INTEGER
+DIM V749 AS INTEGER
+DIM V750 AS INTEGER
+DIM V751 AS INTEGER
+DIM V752 AS INTEGER
+DIM V753 AS INTEGER
+DIM V754 AS INTEGER
+DIM V755 AS INTEGER
+DIM V756 AS INTEGER
+DIM V757 AS INTEGER
+DIM V758 AS INTEGER
+DIM V759 AS INTEGER
+DIM V760 AS INTEGER
+DIM V761 AS INTEGER
+DIM V762 AS INTEGER
+DIM V763 AS INTEGER
+DIM V764 AS INTEGER
+DIM V765 AS INTEGER
+DIM V766 AS INTEGER
+DIM V767 AS INTEGER
+DIM V768 AS INTEGER
+DIM V769 AS INTEGER
+DIM V770 AS INTEGER
+DIM V771 AS INTEGER
+DIM V772 AS INTEGER
+DIM V773 AS INTEGER
+DIM V774 AS INTEGER
+DIM V775 AS INTEGER
+DIM V776 AS INTEGER
+DIM V777 AS INTEGER
+DIM V778 AS INTEGER
+DIM V779 AS INTEGER
+DIM V780 AS INTEGER
+DIM V781 AS INTEGER
+DIM V782 AS INTEGER
+DIM V783 AS INTEGER
+DIM V784 AS INTEGER
+DIM V785 AS INTEGER
+DIM V786 AS INTEGER
+DIM V787 AS INTEGER
+DIM V788 AS INTEGER
+DIM V789 AS INTEGER
+DIM V790 AS INTEGER
+DIM V791 AS INTEGER
+DIM V792 AS INTEGER
+DIM V793 AS INTEGER
+DIM V794 AS INTEGER
+DIM V795 AS INTEGER
+DIM V796 AS INTEGER
+DIM V797 AS INTEGER
+DIM V798 AS INTEGER
+DIM V799 AS INTEGER
+DIM V800 AS INTEGER
+DIM V801 AS INTEGER
+DIM V802 AS INTEGER
+DIM V803 AS INTEGER
+DIM V804 AS INTEGER
+DIM V805 AS INTEGER
+DIM V806 AS INTEGER
+DIM V807 AS INTEGER
+DIM V808 AS INTEGER
+DIM V809 AS INTEGER
+DIM V810 AS INTEGER
+DIM V811 AS INTEGER
+DIM V812 AS INTEGER
+DIM V813 AS INTEGER
+DIM V814 AS INTEGER
+DIM V815 AS INTEGER
+DIM V816 AS INTEGER
+DIM V817 AS INTEGER
+DIM V818 AS INTEGER
+DIM V819 AS INTEGER
+DIM V820 AS INTEGER
+DIM V821 AS INTEGER
+DIM V822 AS INTEGER
+DIM V823 AS INTEGER
+DIM V824 AS INTEGER
+DIM V825 AS INTEGER
+DIM V826 AS INTEGER
+DIM V827 AS INTEGER
+DIM V828 AS INTEGER
+DIM V829 AS INTEGER
+DIM V830 AS INTEGER
+DIM V831 AS INTEGER
+DIM V832 AS INTEGER
+DIM V833 AS INTEGER
+DIM V834 AS INTEGER
+DIM V835 AS INTEGER
+DIM V836 AS INTEGER
+DIM V837 AS INTEGER
+DIM V838 AS INTEGER
+DIM V839 AS INTEGER
+DIM V840 AS INTEGER
+DIM V841 AS INTEGER
+DIM V842 AS INTEGER
+DIM V843 AS INTEGER
+DIM V844 AS INTEGER
+DIM V845 AS INTEGER
+DIM V846 AS INTEGER
+DIM V847 AS INTEGER
+DIM V848 AS INTEGER
+DIM V849 AS INTEGER
+DIM V850 AS INTEGER
+DIM V851 AS INTEGER
+DIM V852 AS INTEGER
+DIM V853 AS INTEGER
+DIM V854 AS INTEGER
+DIM V855 AS INTEGER
+DIM V856 AS INTEGER
+DIM V857 AS INTEGER
+DIM V858 AS INTEGER
+DIM V859 AS INTEGER
+DIM V860 AS INTEGER
+DIM V861 AS INTEGER
+DIM V862 AS INTEGER
+DIM V863 AS INTEGER
+DIM V864 AS INTEGER
+DIM V865 AS INTEGER
+DIM V866 AS INTEGER
+DIM V867 AS INTEGER
+DIM V868 AS INTEGER
+DIM V869 AS INTEGER
+DIM V870 AS INTEGER
+DIM V871 AS INTEGER
+DIM V872 AS INTEGER
+DIM V873 AS INTEGER
+DIM V874 AS INTEGER
+DIM V875 AS INTEGER
+DIM V876 AS INTEGER
+DIM V877 AS INTEGER
+DIM V878 AS INTEGER
+DIM V879 AS INTEGER
+DIM V880 AS INTEGER
+DIM V881 AS INTEGER
+DIM V882 AS INTEGER
+DIM V883 AS INTEGER
+DIM V884 AS INTEGER
+DIM V885 AS INTEGER
+DIM V886 AS INTEGER
+DIM V887 AS INTEGER
+DIM V888 AS INTEGER
+DIM V889 AS INTEGER
+DIM V890 AS INTEGER
+DIM V891 AS INTEGER
+DIM V892 AS INTEGER
+DIM V893 AS INTEGER
+DIM V894 AS INTEGER
+DIM V895 AS INTEGER
+DIM V896 AS INTEGER
+DIM V897 AS INTEGER
+DIM V898 AS INTEGER
+DIM V899 AS INTEGER
+DIM V900 AS INTEGER
+DIM V901 AS INTEGER
+DIM V902 AS INTEGER
+DIM V903 AS INTEGER
+DIM V904 AS INTEGER
+DIM V905 AS INTEGER
+DIM V906 AS INTEGER
+DIM V907 AS INTEGER
+DIM V908 AS INTEGER
+DIM V909 AS INTEGER
+DIM V910 AS INTEGER
+DIM V911 AS INTEGER
+DIM V912 AS INTEGER
+DIM V913 AS INTEGER
+DIM V914 AS INTEGER
+DIM V915 AS INTEGER
+DIM V916 AS INTEGER
+DIM V917 AS INTEGER
+DIM V918 AS INTEGER
+DIM V919 AS INTEGER
+DIM V920 AS INTEGER
+DIM V921 AS INTEGER
+DIM V922 AS INTEGER
+DIM V923 AS INTEGER
+DIM V924 AS INTEGER
+DIM V925 AS INTEGER
+DIM V926 AS INTEGER
+DIM V927 AS INTEGER
+DIM V928 AS INTEGER
+DIM V929 AS INTEGER
+DIM V930 AS INTEGER
+DIM V931 AS INTEGER
+DIM V932 AS INTEGER
+DIM V933 AS INTEGER
+DIM V934 AS INTEGER
+DIM V935 AS INTEGER
+DIM V936 AS INTEGER
+DIM V937 AS INTEGER
+DIM V938 AS INTEGER
+DIM V939 AS INTEGER
+DIM V940 AS INTEGER
+DIM V941 AS INTEGER
+DIM V942 AS INTEGER
+DIM V943 AS INTEGER
+DIM V944 AS INTEGER
+DIM V945 AS INTEGER
+DIM V946 AS INTEGER
+DIM V947 AS INTEGER
+DIM V948 AS INTEGER
+DIM V949 AS INTEGER
+DIM V950 AS INTEGER
+DIM V951 AS INTEGER
+DIM V952 AS INTEGER
+DIM V953 AS INTEGER
+DIM V954 AS INTEGER
+DIM V955 AS INTEGER
+DIM V956 AS INTEGER
+DIM V957 AS INTEGER
+DIM V958 AS INTEGER
+DIM V959 AS INTEGER
+DIM V960 AS INTEGER
+DIM V961 AS INTEGER
+DIM V962 AS INTEGER
+DIM V963 AS INTEGER
+DIM V964 AS INTEGER
+DIM V965 AS INTEGER
+DIM V966 AS INTEGER
+DIM V967 AS INTEGER
+DIM V968 AS INTEGER
+DIM V969 AS INTEGER
+DIM V970 AS INTEGER
+DIM V971 AS INTEGER
+DIM V972 AS INTEGER
+DIM V973 AS INTEGER
+DIM V974 AS INTEGER
+DIM V975 AS INTEGER
+DIM V976 AS INTEGER
+DIM V977 AS INTEGER
+DIM V978 AS INTEGER
+DIM V979 AS INTEGER
+DIM V980 AS INTEGER
+DIM V981 AS INTEGER
+DIM V982 AS INTEGER
+DIM V983 AS INTEGER
+DIM V984 AS INTEGER
+DIM V985 AS INTEGER
+DIM V986 AS INTEGER
+DIM V987 AS INTEGER
+DIM V988 AS INTEGER
+DIM V989 AS INTEGER
+DIM V990 AS INTEGER
+DIM V991 AS INTEGER
+DIM V992 AS INTEGER
+DIM V993 AS INTEGER
+DIM V994 AS INTEGER
+DIM V995 AS INTEGER
+DIM V996 AS INTEGER
+DIM V997 AS INTEGER
+DIM V998 AS INTEGER
+DIM V999 AS INTEGER
+DIM V1000 AS INTEGER
+DIM V1001 AS INTEGER
+DIM V1002 AS INTEGER
+DIM V1003 AS INTEGER
+DIM V1004 AS INTEGER
+DIM V1005 AS INTEGER
+DIM V1006 AS INTEGER
+DIM V1007 AS INTEGER
+DIM V1008 AS INTEGER
+DIM V1009 AS INTEGER
+DIM V1010 AS INTEGER
+DIM V1011 AS INTEGER
+DIM V1012 AS INTEGER
+DIM V1013 AS INTEGER
+DIM V1014 AS INTEGER
+DIM V1015 AS INTEGER
+DIM V1016 AS INTEGER
+DIM V1017 AS INTEGER
+DIM V1018 AS INTEGER
+DIM V1019 AS INTEGER
+DIM V1020 AS INTEGER
+DIM V1021 AS INTEGER
+DIM V1022 AS INTEGER
+DIM V1023 AS INTEGER
+DIM V1024 AS INTEGER
+DIM V1025 AS INTEGER
+DIM V1026 AS INTEGER
+DIM V1027 AS INTEGER
+DIM V1028 AS INTEGER
+DIM V1029 AS INTEGER
+DIM V1030 AS INTEGER
+DIM V1031 AS INTEGER
+DIM V1032 AS INTEGER
+DIM V1033 AS INTEGER
+DIM V1034 AS INTEGER
+DIM V1035 AS INTEGER
+DIM V1036 AS INTEGER
+DIM V1037 AS INTEGER
+DIM V1038 AS INTEGER
+DIM V1039 AS INTEGER
+DIM V1040 AS INTEGER
+DIM V1041 AS INTEGER
+DIM V1042 AS INTEGER
+DIM V1043 AS INTEGER
+DIM V1044 AS INTEGER
+DIM V1045 AS INTEGER
+DIM V1046 AS INTEGER
+DIM V1047 AS INTEGER
+DIM V1048 AS INTEGER
+DIM V1049 AS INTEGER
+DIM V1050 AS INTEGER
+DIM V1051 AS INTEGER
+DIM V1052 AS INTEGER
+DIM V1053 AS INTEGER
+DIM V1054 AS INTEGER
+DIM V1055 AS INTEGER
+DIM V1056 AS INTEGER
+DIM V1057 AS INTEGER
+DIM V1058 AS INTEGER
+DIM V1059 AS INTEGER
+DIM V1060 AS INTEGER
+DIM V1061 AS INTEGER
+DIM V1062 AS INTEGER
+DIM V1063 AS INTEGER
+DIM V1064 AS INTEGER
+DIM V1065 AS INTEGER
+DIM V1066 AS INTEGER
+DIM V1067 AS INTEGER
+DIM V1068 AS INTEGER
+DIM V1069 AS INTEGER
+DIM V1070 AS INTEGER
+DIM V1071 AS INTEGER
+DIM V1072 AS INTEGER
+DIM V1073 AS INTEGER
+DIM V1074 AS INTEGER
+DIM V1075 AS INTEGER
+DIM V1076 AS INTEGER
+DIM V1077 AS INTEGER
+DIM V1078 AS INTEGER
+DIM V1079 AS INTEGER
+DIM V1080 AS INTEGER
+DIM V1081 AS INTEGER
+DIM V1082 AS INTEGER
+DIM V1083 AS INTEGER
+DIM V1084 AS INTEGER
+DIM V1085 AS INTEGER
+DIM V1086 AS INTEGER
+DIM V1087 AS INTEGER
+DIM V1088 AS INTEGER
+DIM V1089 AS INTEGER
+DIM V1090 AS INTEGER
+DIM V1091 AS INTEGER
+DIM V1092 AS INTEGER
+DIM V1093 AS INTEGER
+DIM V1094 AS INTEGER
+DIM V1095 AS INTEGER
+DIM V1096 AS INTEGER
+DIM V1097 AS INTEGER
+DIM V1098 AS INTEGER
+DIM V1099 AS INTEGER
+DIM V1100 AS INTEGER
+DIM V1101 AS INTEGER
+DIM V1102 AS INTEGER
+DIM V1103 AS INTEGER
+DIM V1104 AS INTEGER
+DIM V1105 AS INTEGER
+DIM V1106 AS INTEGER
+DIM V1107 AS INTEGER
+DIM V1108 AS INTEGER
+DIM V1109 AS INTEGER
+DIM V1110 AS INTEGER
+DIM V1111 AS INTEGER
+DIM V1112 AS INTEGER
+DIM V1113 AS INTEGER
+DIM V1114 AS INTEGER
+DIM V1115 AS INTEGER
+DIM V1116 AS INTEGER
+DIM V1117 AS INTEGER
+DIM V1118 AS INTEGER
+DIM V1119 AS INTEGER
+DIM V1120 AS INTEGER
+DIM V1121 AS INTEGER
+DIM V1122 AS INTEGER
+DIM V1123 AS INTEGER
+DIM V1124 AS INTEGER
+DIM V1125 AS INTEGER
+DIM V1126 AS INTEGER
+DIM V1127 AS INTEGER
+DIM V1128 AS INTEGER
+DIM V1129 AS INTEGER
+DIM V1130 AS INTEGER
+DIM V1131 AS INTEGER
+DIM V1132 AS INTEGER
+DIM V1133 AS INTEGER
+DIM V1134 AS INTEGER
+DIM V1135 AS INTEGER
+DIM V1136 AS INTEGER
+DIM V1137 AS INTEGER
+DIM V1138 AS INTEGER
+DIM V1139 AS INTEGER
+DIM V1140 AS INTEGER
+DIM V1141 AS INTEGER
+DIM V1142 AS INTEGER
+DIM V1143 AS INTEGER
+DIM V1144 AS INTEGER
+DIM V1145 AS INTEGER
+DIM V1146 AS INTEGER
+DIM V1147 AS INTEGER
+DIM V1148 AS INTEGER
+DIM V1149 AS INTEGER
+DIM V1150 AS INTEGER
+DIM V1151 AS INTEGER
+DIM V1152 AS INTEGER
+DIM V1153 AS INTEGER
+DIM V1154 AS INTEGER
+DIM V1155 AS INTEGER
+DIM V1156 AS INTEGER
+DIM V1157 AS INTEGER
+DIM V1158 AS INTEGER
+DIM V1159 AS INTEGER
+DIM V1160 AS INTEGER
+DIM V1161 AS INTEGER
+DIM V1162 AS INTEGER
+DIM V1163 AS INTEGER
+DIM V1164 AS INTEGER
+DIM V1165 AS INTEGER
+DIM V1166 AS INTEGER
+DIM V1167 AS INTEGER
+DIM V1168 AS INTEGER
+DIM V1169 AS INTEGER
+DIM V1170 AS INTEGER
+DIM V1171 AS INTEGER
+DIM V1172 AS INTEGER
+DIM V1173 AS INTEGER
+DIM V1174 AS INTEGER
+DIM V1175 AS INTEGER
+DIM V1176 AS INTEGER
+DIM V1177 AS INTEGER
+DIM V1178 AS INTEGER
+DIM V1179 AS INTEGER
+DIM V1180 AS INTEGER
+DIM V1181 AS INTEGER
+DIM V1182 AS INTEGER
+DIM V1183 AS INTEGER
+DIM V1184 AS INTEGER
+DIM V1185 AS INTEGER
+DIM V1186 AS INTEGER
+DIM V1187 AS INTEGER
+DIM V1188 AS INTEGER
+DIM V1189 AS INTEGER
+DIM V1190 AS INTEGER
+DIM V1191 AS INTEGER
+DIM V1192 AS INTEGER
+DIM V1193 AS INTEGER
+DIM V1194 AS INTEGER
+DIM V1195 AS INTEGER
+DIM V1196 AS INTEGER
+DIM V1197 AS INTEGER
+DIM V1198 AS INTEGER
+DIM V1199 AS INTEGER
+DIM V1200 AS INTEGER
+DIM V1201 AS INTEGER
+DIM V1202 AS INTEGER
+DIM V1203 AS INTEGER
+DIM V1204 AS INTEGER
+DIM V1205 AS INTEGER
+DIM V1206 AS INTEGER
+DIM V1207 AS INTEGER
+DIM V1208 AS INTEGER
+DIM V1209 AS INTEGER
+DIM V1210 AS INTEGER
+DIM V1211 AS INTEGER
+DIM V1212 AS INTEGER
+DIM V1213 AS INTEGER
+DIM V1214 AS INTEGER
+DIM V1215 AS INTEGER
+DIM V1216 AS INTEGER
+DIM V1217 AS INTEGER
+DIM V1218 AS INTEGER
+DIM V1219 AS INTEGER
+DIM V1220 AS INTEGER
+DIM V1221 AS INTEGER
+DIM V1222 AS INTEGER
+DIM V1223 AS INTEGER
+DIM V1224 AS INTEGER
+DIM V1225 AS INTEGER
+DIM V1226 AS INTEGER
+DIM V1227 AS INTEGER
+DIM V1228 AS INTEGER
+DIM V1229 AS INTEGER
+DIM V1230 AS INTEGER
+DIM V1231 AS INTEGER
+DIM V1232 AS INTEGER
+DIM V1233 AS INTEGER
+DIM V1234 AS INTEGER
+DIM V1235 AS INTEGER
+DIM V1236 AS INTEGER
+DIM V1237 AS INTEGER
+DIM V1238 AS INTEGER
+DIM V1239 AS INTEGER
+DIM V1240 AS INTEGER
+DIM V1241 AS INTEGER
+DIM V1242 AS INTEGER
+DIM V1243 AS INTEGER
+DIM V1244 AS INTEGER
+DIM V1245 AS INTEGER
+DIM V1246 AS INTEGER
+DIM V1247 AS INTEGER
+DIM V1248 AS INTEGER
+DIM V1249 AS INTEGER
+DIM V1250 AS INTEGER
+DIM V1251 AS INTEGER
+DIM V1252 AS INTEGER
+DIM V1253 AS INTEGER
+DIM V1254 AS INTEGER
+DIM V1255 AS INTEGER
+DIM V1256 AS INTEGER
+DIM V1257 AS INTEGER
+DIM V1258 AS INTEGER
+DIM V1259 AS INTEGER
+DIM V1260 AS INTEGER
+DIM V1261 AS INTEGER
+DIM V1262 AS INTEGER
+DIM V1263 AS INTEGER
+DIM V1264 AS INTEGER
+DIM V1265 AS INTEGER
+DIM V1266 AS INTEGER
+DIM V1267 AS INTEGER
+DIM V1268 AS INTEGER
+DIM V1269 AS INTEGER
+DIM V1270 AS INTEGER
+DIM V1271 AS INTEGER
+DIM V1272 AS INTEGER
+DIM V1273 AS INTEGER
+DIM V1274 AS INTEGER
+DIM V1275 AS INTEGER
+DIM V1276 AS INTEGER
+DIM V1277 AS INTEGER
+DIM V1278 AS INTEGER
+DIM V1279 AS INTEGER
+DIM V1280 AS INTEGER
+DIM V1281 AS INTEGER
+DIM V1282 AS INTEGER
+DIM V1283 AS INTEGER
+DIM V1284 AS INTEGER
+DIM V1285 AS INTEGER
+DIM V1286 AS INTEGER
+DIM V1287 AS INTEGER
+DIM V1288 AS INTEGER
+DIM V1289 AS INTEGER
+DIM V1290 AS INTEGER
+DIM V1291 AS INTEGER
+DIM V1292 AS INTEGER
+DIM V1293 AS INTEGER
+DIM V1294 AS INTEGER
+DIM V1295 AS INTEGER
+DIM V1296 AS INTEGER
+DIM V1297 AS INTEGER
+DIM V1298 AS INTEGER
+DIM V1299 AS INTEGER
+DIM V1300 AS INTEGER
+DIM V1301 AS INTEGER
+DIM V1302 AS INTEGER
+DIM V1303 AS INTEGER
+DIM V1304 AS INTEGER
+DIM V1305 AS INTEGER
+DIM V1306 AS INTEGER
+DIM V1307 AS INTEGER
+DIM V1308 AS INTEGER
+DIM V1309 AS INTEGER
+DIM V1310 AS INTEGER
+DIM V1311 AS INTEGER
+DIM V1312 AS INTEGER
+DIM V1313 AS INTEGER
+DIM V1314 AS INTEGER
+DIM V1315 AS INTEGER
+DIM V1316 AS INTEGER
+DIM V1317 AS INTEGER
+DIM V1318 AS INTEGER
+DIM V1319 AS INTEGER
+DIM V1320 AS INTEGER
+DIM V1321 AS INTEGER
+DIM V1322 AS INTEGER
+DIM V1323 AS INTEGER
+DIM V1324 AS INTEGER
+DIM V1325 AS INTEGER
+DIM V1326 AS INTEGER
+DIM V1327 AS INTEGER
+DIM V1328 AS INTEGER
+DIM V1329 AS INTEGER
+DIM V1330 AS INTEGER
+DIM V1331 AS INTEGER
+DIM V1332 AS INTEGER
+DIM V1333 AS INTEGER
+DIM V1334 AS INTEGER
+DIM V1335 AS INTEGER
+DIM V1336 AS INTEGER
+DIM V1337 AS INTEGER
+DIM V1338 AS INTEGER
+DIM V1339 AS INTEGER
+DIM V1340 AS INTEGER
+DIM V1341 AS INTEGER
+DIM V1342 AS INTEGER
+DIM V1343 AS INTEGER
+DIM V1344 AS INTEGER
+DIM V1345 AS INTEGER
+DIM V1346 AS INTEGER
+DIM V1347 AS INTEGER
+DIM V1348 AS INTEGER
+DIM V1349 AS INTEGER
+DIM V1350 AS INTEGER
+DIM V1351 AS INTEGER
+DIM V1352 AS INTEGER
+DIM V1353 AS INTEGER
+DIM V1354 AS INTEGER
+DIM V1355 AS INTEGER
+DIM V1356 AS INTEGER
+DIM V1357 AS INTEGER
+DIM V1358 AS INTEGER
+DIM V1359 AS INTEGER
+DIM V1360 AS INTEGER
+DIM V1361 AS INTEGER
+DIM V1362 AS INTEGER
+DIM V1363 AS INTEGER
+DIM V1364 AS INTEGER
+DIM V1365 AS INTEGER
+DIM V1366 AS INTEGER
+DIM V1367 AS INTEGER
+DIM V1368 AS INTEGER
+DIM V1369 AS INTEGER
+DIM V1370 AS INTEGER
+DIM V1371 AS INTEGER
+DIM V1372 AS INTEGER
+DIM V1373 AS INTEGER
+DIM V1374 AS INTEGER
+DIM V1375 AS INTEGER
+DIM V1376 AS INTEGER
+DIM V1377 AS INTEGER
+DIM V1378 AS INTEGER
+DIM V1379 AS INTEGER
+DIM V1380 AS INTEGER
+DIM V1381 AS INTEGER
+DIM V1382 AS INTEGER
+DIM V1383 AS INTEGER
+DIM V1384 AS INTEGER
+DIM V1385 AS INTEGER
+DIM V1386 AS INTEGER
+DIM V1387 AS INTEGER
+DIM V1388 AS INTEGER
+DIM V1389 AS INTEGER
+DIM V1390 AS INTEGER
+DIM V1391 AS INTEGER
+DIM V1392 AS INTEGER
+DIM V1393 AS INTEGER
+DIM V1394 AS INTEGER
+DIM V1395 AS INTEGER
+DIM V1396 AS INTEGER
+DIM V1397 AS INTEGER
+DIM V1398 AS INTEGER
+DIM V1399 AS INTEGER
+DIM V1400 AS INTEGER
+DIM V1401 AS INTEGER
+DIM V1402 AS INTEGER
+DIM V1403 AS INTEGER
+DIM V1404 AS INTEGER
+DIM V1405 AS INTEGER
+DIM V1406 AS INTEGER
+DIM V1407 AS INTEGER
+DIM V1408 AS INTEGER
+DIM V1409 AS INTEGER
+DIM V1410 AS INTEGER
+DIM V1411 AS INTEGER
+DIM V1412 AS INTEGER
+DIM V1413 AS INTEGER
+DIM V1414 AS INTEGER
+DIM V1415 AS INTEGER
+DIM V1416 AS INTEGER
+DIM V1417 AS INTEGER
+DIM V1418 AS INTEGER
+DIM V1419 AS INTEGER
+DIM V1420 AS INTEGER
+DIM V1421 AS INTEGER
+DIM V1422 AS INTEGER
+DIM V1423 AS INTEGER
+DIM V1424 AS INTEGER
+DIM V1425 AS INTEGER
+DIM V1426 AS INTEGER
+DIM V1427 AS INTEGER
+DIM V1428 AS INTEGER
+DIM V1429 AS INTEGER
+DIM V1430 AS INTEGER
+DIM V1431 AS INTEGER
+DIM V1432 AS INTEGER
+DIM V1433 AS INTEGER
+DIM V1434 AS INTEGER
+DIM V1435 AS INTEGER
+DIM V1436 AS INTEGER
+DIM V1437 AS INTEGER
+DIM V1438 AS INTEGER
+DIM V1439 AS INTEGER
+DIM V1440 AS INTEGER
+DIM V1441 AS INTEGER
+DIM V1442 AS INTEGER
+DIM V1443 AS INTEGER
+DIM V1444 AS INTEGER
+DIM V1445 AS INTEGER
+DIM V1446 AS INTEGER
+DIM V1447 AS INTEGER
+DIM V1448 AS INTEGER
+DIM V1449 AS INTEGER
+DIM V1450 AS INTEGER
+DIM V1451 AS INTEGER
+DIM V1452 AS INTEGER
+DIM V1453 AS INTEGER
+DIM V1454 AS INTEGER
+DIM V1455 AS INTEGER
+DIM V1456 AS INTEGER
+DIM V1457 AS INTEGER
+DIM V1458 AS INTEGER
+DIM V1459 AS INTEGER
+DIM V1460 AS INTEGER
+DIM V1461 AS INTEGER
+DIM V1462 AS INTEGER
+DIM V1463 AS INTEGER
+DIM V1464 AS INTEGER
+DIM V1465 AS INTEGER
+DIM V1466 AS INTEGER
+DIM V1467 AS INTEGER
+DIM V1468 AS INTEGER
+DIM V1469 AS INTEGER
+DIM V1470 AS INTEGER
+DIM V1471 AS INTEGER
+DIM V1472 AS INTEGER
+DIM V1473 AS INTEGER
+DIM V1474 AS INTEGER
+DIM V1475 AS INTEGER
+DIM V1476 AS INTEGER
+DIM V1477 AS INTEGER
+DIM V1478 AS INTEGER
+DIM V1479 AS INTEGER
+DIM V1480 AS INTEGER
+DIM V1481 AS INTEGER
+DIM V1482 AS INTEGER
+DIM V1483 AS INTEGER
+DIM V1484 AS INTEGER
+DIM V1485 AS INTEGER
+DIM V1486 AS INTEGER
+DIM V1487 AS INTEGER
+DIM V1488 AS INTEGER
+DIM V1489 AS INTEGER
+DIM V1490 AS INTEGER
+DIM V1491 AS INTEGER
+DIM V1492 AS INTEGER
+DIM V1493 AS INTEGER
+DIM V1494 AS INTEGER
+DIM V1495 AS INTEGER
+DIM V1496 AS INTEGER
+DIM V1497 AS INTEGER
+DIM V1498 AS INTEGER
+DIM V1499 AS INTEGER
+DIM V1500 AS INTEGER
+DIM V1501 AS INTEGER
+DIM V1502 AS INTEGER
+DIM V1503 AS INTEGER
+DIM V1504 AS INTEGER
+DIM V1505 AS INTEGER
+DIM V1506 AS INTEGER
+DIM V1507 AS INTEGER
+DIM V1508 AS INTEGER
+DIM V1509 AS INTEGER
+DIM V1510 AS INTEGER
+DIM V1511 AS INTEGER
+DIM V1512 AS INTEGER
+DIM V1513 AS INTEGER
+DIM V1514 AS INTEGER
+DIM V1515 AS INTEGER
+DIM V1516 AS INTEGER
+DIM V1517 AS INTEGER
+DIM V1518 AS INTEGER
+DIM V1519 AS INTEGER
+DIM V1520 AS INTEGER
+DIM V1521 AS INTEGER
+DIM V1522 AS INTEGER
+DIM V1523 AS INTEGER
+DIM V1524 AS INTEGER
+DIM V1525 AS INTEGER
+DIM V1526 AS INTEGER
+DIM V1527 AS INTEGER
+DIM V1528 AS INTEGER
+DIM V1529 AS INTEGER
+DIM V1530 AS INTEGER
+DIM V1531 AS INTEGER
+DIM V1532 AS INTEGER
+DIM V1533 AS INTEGER
+DIM V1534 AS INTEGER
+DIM V1535 AS INTEGER
+DIM V1536 AS INTEGER
+DIM V1537 AS INTEGER
+DIM V1538 AS INTEGER
+DIM V1539 AS INTEGER
+DIM V1540 AS INTEGER
+DIM V1541 AS INTEGER
+DIM V1542 AS INTEGER
+DIM V1543 AS INTEGER
+DIM V1544 AS INTEGER
+DIM V1545 AS INTEGER
+DIM V1546 AS INTEGER
+DIM V1547 AS INTEGER
+DIM V1548 AS INTEGER
+DIM V1549 AS INTEGER
+DIM V1550 AS INTEGER
+DIM V1551 AS INTEGER
+DIM V1552 AS INTEGER
+DIM V1553 AS INTEGER
+DIM V1554 AS INTEGER
+DIM V1555 AS INTEGER
+DIM V1556 AS INTEGER
+DIM V1557 AS INTEGER
+DIM V1558 AS INTEGER
+DIM V1559 AS INTEGER
+DIM V1560 AS INTEGER
+DIM V1561 AS INTEGER
+DIM V1562 AS INTEGER
+DIM V1563 AS INTEGER
+DIM V1564 AS INTEGER
+DIM V1565 AS INTEGER
+DIM V1566 AS INTEGER
+DIM V1567 AS INTEGER
+DIM V1568 AS INTEGER
+DIM V1569 AS INTEGER
+DIM V1570 AS INTEGER
+DIM V1571 AS INTEGER
+DIM V1572 AS INTEGER
+DIM V1573 AS INTEGER
+DIM V1574 AS INTEGER
+DIM V1575 AS INTEGER
+DIM V1576 AS INTEGER
+DIM V1577 AS INTEGER
+DIM V1578 AS INTEGER
+DIM V1579 AS INTEGER
+DIM V1580 AS INTEGER
+DIM V1581 AS INTEGER
+DIM V1582 AS INTEGER
+DIM V1583 AS INTEGER
+DIM V1584 AS INTEGER
+DIM V1585 AS INTEGER
+DIM V1586 AS INTEGER
+DIM V1587 AS INTEGER
+DIM V1588 AS INTEGER
+DIM V1589 AS INTEGER
+DIM V1590 AS INTEGER
+DIM V1591 AS INTEGER
+DIM V1592 AS INTEGER
+DIM V1593 AS INTEGER
+DIM V1594 AS INTEGER
+DIM V1595 AS INTEGER
+DIM V1596 AS INTEGER
+DIM V1597 AS INTEGER
+DIM V1598 AS INTEGER
+DIM V1599 AS INTEGER
+DIM V1600 AS INTEGER
+DIM V1601 AS INTEGER
+DIM V1602 AS INTEGER
+DIM V1603 AS INTEGER
+DIM V1604 AS INTEGER
+DIM V1605 AS INTEGER
+DIM V1606 AS INTEGER
+DIM V1607 AS INTEGER
+DIM V1608 AS INTEGER
+DIM V1609 AS INTEGER
+DIM V1610 AS INTEGER
+DIM V1611 AS INTEGER
+DIM V1612 AS INTEGER
+DIM V1613 AS INTEGER
+DIM V1614 AS INTEGER
+DIM V1615 AS INTEGER
+DIM V1616 AS INTEGER
+DIM V1617 AS INTEGER
+DIM V1618 AS INTEGER
+DIM V1619 AS INTEGER
+DIM V1620 AS INTEGER
+DIM V1621 AS INTEGER
+DIM V1622 AS INTEGER
+DIM V1623 AS INTEGER
+DIM V1624 AS INTEGER
+DIM V1625 AS INTEGER
+DIM V1626 AS INTEGER
+DIM V1627 AS INTEGER
+DIM V1628 AS INTEGER
+DIM V1629 AS INTEGER
+DIM V1630 AS INTEGER
+DIM V1631 AS INTEGER
+DIM V1632 AS INTEGER
+DIM V1633 AS INTEGER
+DIM V1634 AS INTEGER
+DIM V1635 AS INTEGER
+DIM V1636 AS INTEGER
+DIM V1637 AS INTEGER
+DIM V1638 AS INTEGER
+DIM V1639 AS INTEGER
+DIM V1640 AS INTEGER
+DIM V1641 AS INTEGER
+DIM V1642 AS INTEGER
+DIM V1643 AS INTEGER
+DIM V1644 AS INTEGER
+DIM V1645 AS INTEGER
+DIM V1646 AS INTEGER
+DIM V1647 AS INTEGER
+DIM V1648 AS INTEGER
+DIM V1649 AS INTEGER
+DIM V1650 AS INTEGER
+DIM V1651 AS INTEGER
+DIM V1652 AS INTEGER
+DIM V1653 AS INTEGER
+DIM V1654 AS INTEGER
+DIM V1655 AS INTEGER
+DIM V1656 AS INTEGER
+DIM V1657 AS INTEGER
+DIM V1658 AS INTEGER
+DIM V1659 AS INTEGER
+DIM V1660 AS INTEGER
+DIM V1661 AS INTEGER
+DIM V1662 AS INTEGER
+DIM V1663 AS INTEGER
+DIM V1664 AS INTEGER
+DIM V1665 AS INTEGER
+DIM V1666 AS INTEGER
+DIM V1667 AS INTEGER
+DIM V1668 AS INTEGER
+DIM V1669 AS INTEGER
+DIM V1670 AS INTEGER
+DIM V1671 AS INTEGER
+DIM V1672 AS INTEGER
+DIM V1673 AS INTEGER
+DIM V1674 AS INTEGER
+DIM V1675 AS INTEGER
+DIM V1676 AS INTEGER
+DIM V1677 AS INTEGER
+DIM V1678 AS INTEGER
+DIM V1679 AS INTEGER
+DIM V1680 AS INTEGER
+DIM V1681 AS INTEGER
+DIM V1682 AS INTEGER
+DIM V1683 AS INTEGER
+DIM V1684 AS INTEGER
+DIM V1685 AS INTEGER
+DIM V1686 AS INTEGER
+DIM V1687 AS INTEGER
+DIM V1688 AS INTEGER
+DIM V1689 AS INTEGER
+DIM V1690 AS INTEGER
+DIM V1691 AS INTEGER
+DIM V1692 AS INTEGER
+DIM V1693 AS INTEGER
+DIM V1694 AS INTEGER
+DIM V1695 AS INTEGER
+DIM V1696 AS INTEGER
+DIM V1697 AS INTEGER
+DIM V1698 AS INTEGER
+DIM V1699 AS INTEGER
+DIM V1700 AS INTEGER
+DIM V1701 AS INTEGER
+DIM V1702 AS INTEGER
+DIM V1703 AS INTEGER
+DIM V1704 AS INTEGER
+DIM V1705 AS INTEGER
+DIM V1706 AS INTEGER
+DIM V1707 AS INTEGER
+DIM V1708 AS INTEGER
+DIM V1709 AS INTEGER
+DIM V1710 AS INTEGER
+DIM V1711 AS INTEGER
+DIM V1712 AS INTEGER
+DIM V1713 AS INTEGER
+DIM V1714 AS INTEGER
+DIM V1715 AS INTEGER
+DIM V1716 AS INTEGER
+DIM V1717 AS INTEGER
+DIM V1718 AS INTEGER
+DIM V1719 AS INTEGER
+DIM V1720 AS INTEGER
+DIM V1721 AS INTEGER
+DIM V1722 AS INTEGER
+DIM V1723 AS INTEGER
+DIM V1724 AS INTEGER
+DIM V1725 AS INTEGER
+DIM V1726 AS INTEGER
+DIM V1727 AS INTEGER
+DIM V1728 AS INTEGER
+DIM V1729 AS INTEGER
+DIM V1730 AS INTEGER
+DIM V1731 AS INTEGER
+DIM V1732 AS INTEGER
+DIM V1733 AS INTEGER
+DIM V1734 AS INTEGER
+DIM V1735 AS INTEGER
+DIM V1736 AS INTEGER
+DIM V1737 AS INTEGER
+DIM V1738 AS INTEGER
+DIM V1739 AS INTEGER
+DIM V1740 AS INTEGER
+DIM V1741 AS INTEGER
+DIM V1742 AS INTEGER
+DIM V1743 AS INTEGER
+DIM V1744 AS INTEGER
+DIM V1745 AS INTEGER
+DIM V1746 AS INTEGER
+DIM V1747 AS INTEGER
+DIM V1748 AS INTEGER
+DIM V1749 AS INTEGER
+DIM V1750 AS INTEGER
+DIM V1751 AS INTEGER
+DIM V1752 AS INTEGER
+DIM V1753 AS INTEGER
+DIM V1754 AS INTEGER
+DIM V1755 AS INTEGER
+DIM V1756 AS INTEGER
+DIM V1757 AS INTEGER
+DIM V1758 AS INTEGER
+DIM V1759 AS INTEGER
+DIM V1760 AS INTEGER
+DIM V1761 AS INTEGER
+DIM V1762 AS INTEGER
+DIM V1763 AS INTEGER
+DIM V1764 AS INTEGER
+DIM V1765 AS INTEGER
+DIM V1766 AS INTEGER
+DIM V1767 AS INTEGER
+DIM V1768 AS INTEGER
+DIM V1769 AS INTEGER
+DIM V1770 AS INTEGER
+DIM V1771 AS INTEGER
+DIM V1772 AS INTEGER
+DIM V1773 AS INTEGER
+DIM V1774 AS INTEGER
+DIM V1775 AS INTEGER
+DIM V1776 AS INTEGER
+DIM V1777 AS INTEGER
+DIM V1778 AS INTEGER
+DIM V1779 AS INTEGER
+DIM V1780 AS INTEGER
+DIM V1781 AS INTEGER
+DIM V1782 AS INTEGER
+DIM V1783 AS INTEGER
+DIM V1784 AS INTEGER
+DIM V1785 AS INTEGER
+DIM V1786 AS INTEGER
+DIM V1787 AS INTEGER
+DIM V1788 AS INTEGER
+DIM V1789 AS INTEGER
+DIM V1790 AS INTEGER
+DIM V1791 AS INTEGER
+DIM V1792 AS INTEGER
+DIM V1793 AS INTEGER
+DIM V1794 AS INTEGER
+DIM V1795 AS INTEGER
+DIM V1796 AS INTEGER
+DIM V1797 AS INTEGER
+DIM V1798 AS INTEGER
+DIM V1799 AS INTEGER
+DIM V1800 AS INTEGER
+DIM V1801 AS INTEGER
+DIM V1802 AS INTEGER
+DIM V1803 AS INTEGER
+DIM V1804 AS INTEGER
+DIM V1805 AS INTEGER
+DIM V1806 AS INTEGER
+DIM V1807 AS INTEGER
+DIM V1808 AS INTEGER
+DIM V1809 AS INTEGER
+DIM V1810 AS INTEGER
+DIM V1811 AS INTEGER
+DIM V1812 AS INTEGER
+DIM V1813 AS INTEGER
+DIM V1814 AS INTEGER
+DIM V1815 AS INTEGER
+DIM V1816 AS INTEGER
+DIM V1817 AS INTEGER
+DIM V1818 AS INTEGER
+DIM V1819 AS INTEGER
+DIM V1820 AS INTEGER
+DIM V1821 AS INTEGER
+DIM V1822 AS INTEGER
+DIM V1823 AS INTEGER
+DIM V1824 AS INTEGER
+DIM V1825 AS INTEGER
+DIM V1826 AS INTEGER
+DIM V1827 AS INTEGER
+DIM V1828 AS INTEGER
+DIM V1829 AS INTEGER
+DIM V1830 AS INTEGER
+DIM V1831 AS INTEGER
+DIM V1832 AS INTEGER
+DIM V1833 AS INTEGER
+DIM V1834 AS INTEGER
+DIM V1835 AS INTEGER
+DIM V1836 AS INTEGER
+DIM V1837 AS INTEGER
+DIM V1838 AS INTEGER
+DIM V1839 AS INTEGER
+DIM V1840 AS INTEGER
+DIM V1841 AS INTEGER
+DIM V1842 AS INTEGER
+DIM V1843 AS INTEGER
+DIM V1844 AS INTEGER
+DIM V1845 AS INTEGER
+DIM V1846 AS INTEGER
+DIM V1847 AS INTEGER
+DIM V1848 AS INTEGER
+DIM V1849 AS INTEGER
+DIM V1850 AS INTEGER
+DIM V1851 AS INTEGER
+DIM V1852 AS INTEGER
+DIM V1853 AS INTEGER
+DIM V1854 AS INTEGER
+DIM V1855 AS INTEGER
+DIM V1856 AS INTEGER
+DIM V1857 AS INTEGER
+DIM V1858 AS INTEGER
+DIM V1859 AS INTEGER
+DIM V1860 AS INTEGER
+DIM V1861 AS INTEGER
+DIM V1862 AS INTEGER
+DIM V1863 AS INTEGER
+DIM V1864 AS INTEGER
+DIM V1865 AS INTEGER
+DIM V1866 AS INTEGER
+DIM V1867 AS INTEGER
+DIM V1868 AS INTEGER
+DIM V1869 AS INTEGER
+DIM V1870 AS INTEGER
+DIM V1871 AS INTEGER
+DIM V1872 AS INTEGER
+DIM V1873 AS INTEGER
+DIM V1874 AS INTEGER
+DIM V1875 AS INTEGER
+DIM V1876 AS INTEGER
+DIM V1877 AS INTEGER
+DIM V1878 AS INTEGER
+DIM V1879 AS INTEGER
+DIM V1880 AS INTEGER
+DIM V1881 AS INTEGER
+DIM V1882 AS INTEGER
+DIM V1883 AS INTEGER
+DIM V1884 AS INTEGER
+DIM V1885 AS INTEGER
+DIM V1886 AS INTEGER
+DIM V1887 AS INTEGER
+DIM V1888 AS INTEGER
+DIM V1889 AS INTEGER
+DIM V1890 AS INTEGER
+DIM V1891 AS INTEGER
+DIM V1892 AS INTEGER
+DIM V1893 AS INTEGER
+DIM V1894 AS INTEGER
+DIM V1895 AS INTEGER
+DIM V1896 AS INTEGER
+DIM V1897 AS INTEGER
+DIM V1898 AS INTEGER
+DIM V1899 AS INTEGER
+DIM V1900 AS INTEGER
+DIM V1901 AS INTEGER
+DIM V1902 AS INTEGER
+DIM V1903 AS INTEGER
+DIM V1904 AS INTEGER
+DIM V1905 AS INTEGER
+DIM V1906 AS INTEGER
+DIM V1907 AS INTEGER
+DIM V1908 AS INTEGER
+DIM V1909 AS INTEGER
+DIM V1910 AS INTEGER
+DIM V1911 AS INTEGER
+DIM V1912 AS INTEGER
+DIM V1913 AS INTEGER
+DIM V1914 AS INTEGER
+DIM V1915 AS INTEGER
+DIM V1916 AS INTEGER
+DIM V1917 AS INTEGER
+DIM V1918 AS INTEGER
+DIM V1919 AS INTEGER
+DIM V1920 AS INTEGER
+DIM V1921 AS INTEGER
+DIM V1922 AS INTEGER
+DIM V1923 AS INTEGER
+DIM V1924 AS INTEGER
+DIM V1925 AS INTEGER
+DIM V1926 AS INTEGER
+DIM V1927 AS INTEGER
+DIM V1928 AS INTEGER
+DIM V1929 AS INTEGER
+DIM V1930 AS INTEGER
+DIM V1931 AS INTEGER
+DIM V1932 AS INTEGER
+DIM V1933 AS INTEGER
+DIM V1934 AS INTEGER
+DIM V1935 AS INTEGER
+DIM V1936 AS INTEGER
+DIM V1937 AS INTEGER
+DIM V1938 AS INTEGER
+DIM V1939 AS INTEGER
+DIM V1940 AS INTEGER
+DIM V1941 AS INTEGER
+DIM V1942 AS INTEGER
+DIM V1943 AS INTEGER
+DIM V1944 AS INTEGER
+DIM V1945 AS INTEGER
+DIM V1946 AS INTEGER
+DIM V1947 AS INTEGER
+DIM V1948 AS INTEGER
+DIM V1949 AS INTEGER
+DIM V1950 AS INTEGER
+DIM V1951 AS INTEGER
+DIM V1952 AS INTEGER
+DIM V1953 AS INTEGER
+DIM V1954 AS INTEGER
+DIM V1955 AS INTEGER
+DIM V1956 AS INTEGER
+DIM V1957 AS INTEGER
+DIM V1958 AS INTEGER
+DIM V1959 AS INTEGER
+DIM V1960 AS INTEGER
+DIM V1961 AS INTEGER
+DIM V1962 AS INTEGER
+DIM V1963 AS INTEGER
+DIM V1964 AS INTEGER
+DIM V1965 AS INTEGER
+DIM V1966 AS INTEGER
+DIM V1967 AS INTEGER
+DIM V1968 AS INTEGER
+DIM V1969 AS INTEGER
+DIM V1970 AS INTEGER
+DIM V1971 AS INTEGER
+DIM V1972 AS INTEGER
+DIM V1973 AS INTEGER
+DIM V1974 AS INTEGER
+DIM V1975 AS INTEGER
+DIM V1976 AS INTEGER
+DIM V1977 AS INTEGER
+DIM V1978 AS INTEGER
+DIM V1979 AS INTEGER
+DIM V1980 AS INTEGER
+DIM V1981 AS INTEGER
+DIM V1982 AS INTEGER
+DIM V1983 AS INTEGER
+DIM V1984 AS INTEGER
+DIM V1985 AS INTEGER
+DIM V1986 AS INTEGER
+DIM V1987 AS INTEGER
+DIM V1988 AS INTEGER
+DIM V1989 AS INTEGER
+DIM V1990 AS INTEGER
+DIM V1991 AS INTEGER
+DIM V1992 AS INTEGER
+DIM V1993 AS INTEGER
+DIM V1994 AS INTEGER
+DIM V1995 AS INTEGER
+DIM V1996 AS INTEGER
+DIM V1997 AS INTEGER
+DIM V1998 AS INTEGER
+DIM V1999 AS INTEGER
+DIM V2000 AS INTEGER
+DIM V2001 AS INTEGER
+DIM V2002 AS INTEGER
+DIM V2003 AS INTEGER
+DIM V2004 AS INTEGER
+DIM V2005 AS INTEGER
+DIM V2006 AS INTEGER
+DIM V2007 AS INTEGER
+DIM V2008 AS INTEGER
+DIM V2009 AS INTEGER
+DIM V2010 AS INTEGER
+DIM V2011 AS INTEGER
+DIM V2012 AS INTEGER
+DIM V2013 AS INTEGER
+DIM V2014 AS INTEGER
+DIM V2015 AS INTEGER
+DIM V2016 AS INTEGER
+DIM V2017 AS INTEGER
+DIM V2018 AS INTEGER
+DIM V2019 AS INTEGER
+DIM V2020 AS INTEGER
+DIM V2021 AS INTEGER
+DIM V2022 AS INTEGER
+DIM V2023 AS INTEGER
+DIM V2024 AS INTEGER
+DIM V2025 AS INTEGER
+DIM V2026 AS INTEGER
+DIM V2027 AS INTEGER
+DIM V2028 AS INTEGER
+DIM V2029 AS INTEGER
+DIM V2030 AS INTEGER
+DIM V2031 AS INTEGER
+DIM V2032 AS INTEGER
+DIM V2033 AS INTEGER
+DIM V2034 AS INTEGER
+DIM V2035 AS INTEGER
+DIM V2036 AS INTEGER
+DIM V2037 AS INTEGER
+DIM V2038 AS INTEGER
+DIM V2039 AS INTEGER
+DIM V2040 AS INTEGER
+DIM V2041 AS INTEGER
+DIM V2042 AS INTEGER
+DIM V2043 AS INTEGER
+DIM V2044 AS INTEGER
+DIM V2045 AS INTEGER
+DIM V2046 AS INTEGER
+DIM V2047 AS INTEGER
+DIM V2048 AS INTEGER
+DIM V2049 AS INTEGER
+DIM V2050 AS INTEGER
+DIM V2051 AS INTEGER
+DIM V2052 AS INTEGER
+DIM V2053 AS INTEGER
+DIM V2054 AS INTEGER
+DIM V2055 AS INTEGER
+DIM V2056 AS INTEGER
+DIM V2057 AS INTEGER
+DIM V2058 AS INTEGER
+DIM V2059 AS INTEGER
+DIM V2060 AS INTEGER
+DIM V2061 AS INTEGER
+DIM V2062 AS INTEGER
+DIM V2063 AS INTEGER
+DIM V2064 AS INTEGER
+DIM V2065 AS INTEGER
+DIM V2066 AS INTEGER
+DIM V2067 AS INTEGER
+DIM V2068 AS INTEGER
+DIM V2069 AS INTEGER
+DIM V2070 AS INTEGER
+DIM V2071 AS INTEGER
+DIM V2072 AS INTEGER
+DIM V2073 AS INTEGER
+DIM V2074 AS INTEGER
+DIM V2075 AS INTEGER
+DIM V2076 AS INTEGER
+DIM V2077 AS INTEGER
+DIM V2078 AS INTEGER
+DIM V2079 AS INTEGER
+DIM V2080 AS INTEGER
+DIM V2081 AS INTEGER
+DIM V2082 AS INTEGER
+DIM V2083 AS INTEGER
+DIM V2084 AS INTEGER
+DIM V2085 AS INTEGER
+DIM V2086 AS INTEGER
+DIM V2087 AS INTEGER
+DIM V2088 AS INTEGER
+DIM V2089 AS INTEGER
+DIM V2090 AS INTEGER
+DIM V2091 AS INTEGER
+DIM V2092 AS INTEGER
+DIM V2093 AS INTEGER
+DIM V2094 AS INTEGER
+DIM V2095 AS INTEGER
+DIM V2096 AS INTEGER
+DIM V2097 AS INTEGER
+DIM V2098 AS INTEGER
+DIM V2099 AS INTEGER
+DIM V2100 AS INTEGER
+DIM V2101 AS INTEGER
+DIM V2102 AS INTEGER
+DIM V2103 AS INTEGER
+DIM V2104 AS INTEGER
+DIM V2105 AS INTEGER
+DIM V2106 AS INTEGER
+DIM V2107 AS INTEGER
+DIM V2108 AS INTEGER
+DIM V2109 AS INTEGER
+DIM V2110 AS INTEGER
+DIM V2111 AS INTEGER
+DIM V2112 AS INTEGER
+DIM V2113 AS INTEGER
+DIM V2114 AS INTEGER
+DIM V2115 AS INTEGER
+DIM V2116 AS INTEGER
+DIM V2117 AS INTEGER
+DIM V2118 AS INTEGER
+DIM V2119 AS INTEGER
+DIM V2120 AS INTEGER
+DIM V2121 AS INTEGER
+DIM V2122 AS INTEGER
+DIM V2123 AS INTEGER
+DIM V2124 AS INTEGER
+DIM V2125 AS INTEGER
+DIM V2126 AS INTEGER
+DIM V2127 AS INTEGER
+DIM V2128 AS INTEGER
+DIM V2129 AS INTEGER
+DIM V2130 AS INTEGER
+DIM V2131 AS INTEGER
+DIM V2132 AS INTEGER
+DIM V2133 AS INTEGER
+DIM V2134 AS INTEGER
+DIM V2135 AS INTEGER
+DIM V2136 AS INTEGER
+DIM V2137 AS INTEGER
+DIM V2138 AS INTEGER
+DIM V2139 AS INTEGER
+DIM V2140 AS INTEGER
+DIM V2141 AS INTEGER
+DIM V2142 AS INTEGER
+DIM V2143 AS INTEGER
+DIM V2144 AS INTEGER
+DIM V2145 AS INTEGER
+DIM V2146 AS INTEGER
+DIM V2147 AS INTEGER
+DIM V2148 AS INTEGER
+DIM V2149 AS INTEGER
+DIM V2150 AS INTEGER
+DIM V2151 AS INTEGER
+DIM V2152 AS INTEGER
+DIM V2153 AS INTEGER
+DIM V2154 AS INTEGER
+DIM V2155 AS INTEGER
+DIM V2156 AS INTEGER
+DIM V2157 AS INTEGER
+DIM V2158 AS INTEGER
+DIM V2159 AS INTEGER
+DIM V2160 AS INTEGER
+DIM V2161 AS INTEGER
+DIM V2162 AS INTEGER
+DIM V2163 AS INTEGER
+DIM V2164 AS INTEGER
+DIM V2165 AS INTEGER
+DIM V2166 AS INTEGER
+DIM V2167 AS INTEGER
+DIM V2168 AS INTEGER
+DIM V2169 AS INTEGER
+DIM V2170 AS INTEGER
+DIM V2171 AS INTEGER
+DIM V2172 AS INTEGER
+DIM V2173 AS INTEGER
+DIM V2174 AS INTEGER
+DIM V2175 AS INTEGER
+DIM V2176 AS INTEGER
+DIM V2177 AS INTEGER
+DIM V2178 AS INTEGER
+DIM V2179 AS INTEGER
+DIM V2180 AS INTEGER
+DIM V2181 AS INTEGER
+DIM V2182 AS INTEGER
+DIM V2183 AS INTEGER
+DIM V2184 AS INTEGER
+DIM V2185 AS INTEGER
+DIM V2186 AS INTEGER
+DIM V2187 AS INTEGER
+DIM V2188 AS INTEGER
+DIM V2189 AS INTEGER
+DIM V2190 AS INTEGER
+DIM V2191 AS INTEGER
+DIM V2192 AS INTEGER
+DIM V2193 AS INTEGER
+DIM V2194 AS INTEGER
+DIM V2195 AS INTEGER
+DIM V2196 AS INTEGER
+DIM V2197 AS INTEGER
+DIM V2198 AS INTEGER
+DIM V2199 AS INTEGER
+DIM V2200 AS INTEGER
+DIM V2201 AS INTEGER
+DIM V2202 AS INTEGER
+DIM V2203 AS INTEGER
+DIM V2204 AS INTEGER
+DIM V2205 AS INTEGER
+DIM V2206 AS INTEGER
+DIM V2207 AS INTEGER
+DIM V2208 AS INTEGER
+DIM V2209 AS INTEGER
+DIM V2210 AS INTEGER
+DIM V2211 AS INTEGER
+DIM V2212 AS INTEGER
+DIM V2213 AS INTEGER
+DIM V2214 AS INTEGER
+DIM V2215 AS INTEGER
+DIM V2216 AS INTEGER
+DIM V2217 AS INTEGER
+DIM V2218 AS INTEGER
+DIM V2219 AS INTEGER
+DIM V2220 AS INTEGER
+DIM V2221 AS INTEGER
+DIM V2222 AS INTEGER
+DIM V2223 AS INTEGER
+DIM V2224 AS INTEGER
+DIM V2225 AS INTEGER
+DIM V2226 AS INTEGER
+DIM V2227 AS INTEGER
+DIM V2228 AS INTEGER
+DIM V2229 AS INTEGER
+DIM V2230 AS INTEGER
+DIM V2231 AS INTEGER
+DIM V2232 AS INTEGER
+DIM V2233 AS INTEGER
+DIM V2234 AS INTEGER
+DIM V2235 AS INTEGER
+DIM V2236 AS INTEGER
+DIM V2237 AS INTEGER
+DIM V2238 AS INTEGER
+DIM V2239 AS INTEGER
+DIM V2240 AS INTEGER
+DIM V2241 AS INTEGER
+DIM V2242 AS INTEGER
+DIM V2243 AS INTEGER
+DIM V2244 AS INTEGER
+DIM V2245 AS INTEGER
+DIM V2246 AS INTEGER
+DIM V2247 AS INTEGER
+DIM V2248 AS INTEGER
+DIM V2249 AS INTEGER
+DIM V2250 AS INTEGER
+DIM V2251 AS INTEGER
+DIM V2252 AS INTEGER
+DIM V2253 AS INTEGER
+DIM V2254 AS INTEGER
+DIM V2255 AS INTEGER
+DIM V2256 AS INTEGER
+DIM V2257 AS INTEGER
+DIM V2258 AS INTEGER
+DIM V2259 AS INTEGER
+DIM V2260 AS INTEGER
+DIM V2261 AS INTEGER
+DIM V2262 AS INTEGER
+DIM V2263 AS INTEGER
+DIM V2264 AS INTEGER
+DIM V2265 AS INTEGER
+DIM V2266 AS INTEGER
+DIM V2267 AS INTEGER
+DIM V2268 AS INTEGER
+DIM V2269 AS INTEGER
+DIM V2270 AS INTEGER
+DIM V2271 AS INTEGER
+DIM V2272 AS INTEGER
+DIM V2273 AS INTEGER
+DIM V2274 AS INTEGER
+DIM V2275 AS INTEGER
+DIM V2276 AS INTEGER
+DIM V2277 AS INTEGER
+DIM V2278 AS INTEGER
+DIM V2279 AS INTEGER
+DIM V2280 AS INTEGER
+DIM V2281 AS INTEGER
+DIM V2282 AS INTEGER
+DIM V2283 AS INTEGER
+DIM V2284 AS INTEGER
+DIM V2285 AS INTEGER
+DIM V2286 AS INTEGER
+DIM V2287 AS INTEGER
+DIM V2288 AS INTEGER
+DIM V2289 AS INTEGER
+DIM V2290 AS INTEGER
+DIM V2291 AS INTEGER
+DIM V2292 AS INTEGER
+DIM V2293 AS INTEGER
+DIM V2294 AS INTEGER
+DIM V2295 AS INTEGER
+DIM V2296 AS INTEGER
+DIM V2297 AS INTEGER
+DIM V2298 AS INTEGER
+DIM V2299 AS INTEGER
+DIM V2300 AS INTEGER
+DIM V2301 AS INTEGER
+DIM V2302 AS INTEGER
+DIM V2303 AS INTEGER
+DIM V2304 AS INTEGER
+DIM V2305 AS INTEGER
+DIM V2306 AS INTEGER
+DIM V2307 AS INTEGER
+DIM V2308 AS INTEGER
+DIM V2309 AS INTEGER
+DIM V2310 AS INTEGER
+DIM V2311 AS INTEGER
+DIM V2312 AS INTEGER
+DIM V2313 AS INTEGER
+DIM V2314 AS INTEGER
+DIM V2315 AS INTEGER
+DIM V2316 AS INTEGER
+DIM V2317 AS INTEGER
+DIM V2318 AS INTEGER
+DIM V2319 AS INTEGER
+DIM V2320 AS INTEGER
+DIM V2321 AS INTEGER
+DIM V2322 AS INTEGER
+DIM V2323 AS INTEGER
+DIM V2324 AS INTEGER
+DIM V2325 AS INTEGER
+DIM V2326 AS INTEGER
+DIM V2327 AS INTEGER
+DIM V2328 AS INTEGER
+DIM V2329 AS INTEGER
+DIM V2330 AS INTEGER
+DIM V2331 AS INTEGER
+DIM V2332 AS INTEGER
+DIM V2333 AS INTEGER
+DIM V2334 AS INTEGER
+DIM V2335 AS INTEGER
+DIM V2336 AS INTEGER
+DIM V2337 AS INTEGER
+DIM V2338 AS INTEGER
+DIM V2339 AS INTEGER
+DIM V2340 AS INTEGER
+DIM V2341 AS INTEGER
+DIM V2342 AS INTEGER
+DIM V2343 AS INTEGER
+DIM V2344 AS INTEGER
+DIM V2345 AS INTEGER
+DIM V2346 AS INTEGER
+DIM V2347 AS INTEGER
+DIM V2348 AS INTEGER
+DIM V2349 AS INTEGER
+DIM V2350 AS INTEGER
+DIM V2351 AS INTEGER
+DIM V2352 AS INTEGER
+DIM V2353 AS INTEGER
+DIM V2354 AS INTEGER
+DIM V2355 AS INTEGER
+DIM V2356 AS INTEGER
+DIM V2357 AS INTEGER
+DIM V2358 AS INTEGER
+DIM V2359 AS INTEGER
+DIM V2360 AS INTEGER
+DIM V2361 AS INTEGER
+DIM V2362 AS INTEGER
+DIM V2363 AS INTEGER
+DIM V2364 AS INTEGER
+DIM V2365 AS INTEGER
+DIM V2366 AS INTEGER
+DIM V2367 AS INTEGER
+DIM V2368 AS INTEGER
+DIM V2369 AS INTEGER
+DIM V2370 AS INTEGER
+DIM V2371 AS INTEGER
+DIM V2372 AS INTEGER
+DIM V2373 AS INTEGER
+DIM V2374 AS INTEGER
+DIM V2375 AS INTEGER
+DIM V2376 AS INTEGER
+DIM V2377 AS INTEGER
+DIM V2378 AS INTEGER
+DIM V2379 AS INTEGER
+DIM V2380 AS INTEGER
+DIM V2381 AS INTEGER
+DIM V2382 AS INTEGER
+DIM V2383 AS INTEGER
+DIM V2384 AS INTEGER
+DIM V2385 AS INTEGER
+DIM V2386 AS INTEGER
+DIM V2387 AS INTEGER
+DIM V2388 AS INTEGER
+DIM V2389 AS INTEGER
+DIM V2390 AS INTEGER
+DIM V2391 AS INTEGER
+DIM V2392 AS INTEGER
+DIM V2393 AS INTEGER
+DIM V2394 AS INTEGER
+DIM V2395 AS INTEGER
+DIM V2396 AS INTEGER
+DIM V2397 AS INTEGER
+DIM V2398 AS INTEGER
+DIM V2399 AS INTEGER
+DIM V2400 AS INTEGER
+DIM V2401 AS INTEGER
+DIM V2402 AS INTEGER
+DIM V2403 AS INTEGER
+DIM V2404 AS INTEGER
+DIM V2405 AS INTEGER
+DIM V2406 AS INTEGER
+DIM V2407 AS INTEGER
+DIM V2408 AS INTEGER
+DIM V2409 AS INTEGER
+DIM V2410 AS INTEGER
+DIM V2411 AS INTEGER
+DIM V2412 AS INTEGER
+DIM V2413 AS INTEGER
+DIM V2414 AS INTEGER
+DIM V2415 AS INTEGER
+DIM V2416 AS INTEGER
+DIM V2417 AS INTEGER
+DIM V2418 AS INTEGER
+DIM V2419 AS INTEGER
+DIM V2420 AS INTEGER
+DIM V2421 AS INTEGER
+DIM V2422 AS INTEGER
+DIM V2423 AS INTEGER
+DIM V2424 AS INTEGER
+DIM V2425 AS INTEGER
+DIM V2426 AS INTEGER
+DIM V2427 AS INTEGER
+DIM V2428 AS INTEGER
+DIM V2429 AS INTEGER
+DIM V2430 AS INTEGER
+DIM V2431 AS INTEGER
+DIM V2432 AS INTEGER
+DIM V2433 AS INTEGER
+DIM V2434 AS INTEGER
+DIM V2435 AS INTEGER
+DIM V2436 AS INTEGER
+DIM V2437 AS INTEGER
+DIM V2438 AS INTEGER
+DIM V2439 AS INTEGER
+DIM V2440 AS INTEGER
+DIM V2441 AS INTEGER
+DIM V2442 AS INTEGER
+DIM V2443 AS INTEGER
+DIM V2444 AS INTEGER
+DIM V2445 AS INTEGER
+DIM V2446 AS INTEGER
+DIM V2447 AS INTEGER
+DIM V2448 AS INTEGER
+DIM V2449 AS INTEGER
+DIM V2450 AS INTEGER
+DIM V2451 AS INTEGER
+DIM V2452 AS INTEGER
+DIM V2453 AS INTEGER
+DIM V2454 AS INTEGER
+DIM V2455 AS INTEGER
+DIM V2456 AS INTEGER
+DIM V2457 AS INTEGER
+DIM V2458 AS INTEGER
+DIM V2459 AS INTEGER
+DIM V2460 AS INTEGER
+DIM V2461 AS INTEGER
+DIM V2462 AS INTEGER
+DIM V2463 AS INTEGER
+DIM V2464 AS INTEGER
+DIM V2465 AS INTEGER
+DIM V2466 AS INTEGER
+DIM V2467 AS INTEGER
+DIM V2468 AS INTEGER
+DIM V2469 AS INTEGER
+DIM V2470 AS INTEGER
+DIM V2471 AS INTEGER
+DIM V2472 AS INTEGER
+DIM V2473 AS INTEGER
+DIM V2474 AS INTEGER
+DIM V2475 AS INTEGER
+DIM V2476 AS INTEGER
+DIM V2477 AS INTEGER
+DIM V2478 AS INTEGER
+DIM V2479 AS INTEGER
+DIM V2480 AS INTEGER
+DIM V2481 AS INTEGER
+DIM V2482 AS INTEGER
+DIM V2483 AS INTEGER
+DIM V2484 AS INTEGER
+DIM V2485 AS INTEGER
+DIM V2486 AS INTEGER
+DIM V2487 AS INTEGER
+DIM V2488 AS INTEGER
+DIM V2489 AS INTEGER
+DIM V2490 AS INTEGER
+DIM V2491 AS INTEGER
+DIM V2492 AS INTEGER
+DIM V2493 AS INTEGER
+DIM V2494 AS INTEGER
+DIM V2495 AS INTEGER
+DIM V2496 AS INTEGER
+DIM V2497 AS INTEGER
+DIM V2498 AS INTEGER
+DIM V2499 AS INTEGER
+DIM V2500 AS INTEGER
+DIM V2501 AS INTEGER
+DIM V2502 AS INTEGER
+DIM V2503 AS INTEGER
+DIM V2504 AS INTEGER
+DIM V2505 AS INTEGER
+DIM V2506 AS INTEGER
+DIM V2507 AS INTEGER
+DIM V2508 AS INTEGER
+DIM V2509 AS INTEGER
+DIM V2510 AS INTEGER
+DIM V2511 AS INTEGER
+DIM V2512 AS INTEGER
+DIM V2513 AS INTEGER
+DIM V2514 AS INTEGER
+DIM V2515 AS INTEGER
+DIM V2516 AS INTEGER
+DIM V2517 AS INTEGER
+DIM V2518 AS INTEGER
+DIM V2519 AS INTEGER
+DIM V2520 AS INTEGER
+DIM V2521 AS INTEGER
+DIM V2522 AS INTEGER
+DIM V2523 AS INTEGER
+DIM V2524 AS INTEGER
+DIM V2525 AS INTEGER
+DIM V2526 AS INTEGER
+DIM V2527 AS INTEGER
+DIM V2528 AS INTEGER
+DIM V2529 AS INTEGER
+DIM V2530 AS INTEGER
+DIM V2531 AS INTEGER
+DIM V2532 AS INTEGER
+DIM V2533 AS INTEGER
+DIM V2534 AS INTEGER
+DIM V2535 AS INTEGER
+DIM V2536 AS INTEGER
+DIM V2537 AS INTEGER
+DIM V2538 AS INTEGER
+DIM V2539 AS INTEGER
+DIM V2540 AS INTEGER
+DIM V2541 AS INTEGER
+DIM V2542 AS INTEGER
+DIM V2543 AS INTEGER
+DIM V2544 AS INTEGER
+DIM V2545 AS INTEGER
+DIM V2546 AS INTEGER
+DIM V2547 AS INTEGER
+DIM V2548 AS INTEGER
+DIM V2549 AS INTEGER
+DIM V2550 AS INTEGER
+DIM V2551 AS INTEGER
+DIM V2552 AS INTEGER
+DIM V2553 AS INTEGER
+DIM V2554 AS INTEGER
+DIM V2555 AS INTEGER
+DIM V2556 AS INTEGER
+DIM V2557 AS INTEGER
+DIM V2558 AS INTEGER
+DIM V2559 AS INTEGER
+DIM V2560 AS INTEGER
+DIM V2561 AS INTEGER
+DIM V2562 AS INTEGER
+DIM V2563 AS INTEGER
+DIM V2564 AS INTEGER
+DIM V2565 AS INTEGER
+DIM V2566 AS INTEGER
+DIM V2567 AS INTEGER
+DIM V2568 AS INTEGER
+DIM V2569 AS INTEGER
+DIM V2570 AS INTEGER
+DIM V2571 AS INTEGER
+DIM V2572 AS INTEGER
+DIM V2573 AS INTEGER
+DIM V2574 AS INTEGER
+DIM V2575 AS INTEGER
+DIM V2576 AS INTEGER
+DIM V2577 AS INTEGER
+DIM V2578 AS INTEGER
+DIM V2579 AS INTEGER
+DIM V2580 AS INTEGER
+DIM V2581 AS INTEGER
+DIM V2582 AS INTEGER
+DIM V2583 AS INTEGER
+DIM V2584 AS INTEGER
+DIM V2585 AS INTEGER
+DIM V2586 AS INTEGER
+DIM V2587 AS INTEGER
+DIM V2588 AS INTEGER
+DIM V2589 AS INTEGER
+DIM V2590 AS INTEGER
+DIM V2591 AS INTEGER
+DIM V2592 AS INTEGER
+DIM V2593 AS INTEGER
+DIM V2594 AS INTEGER
+DIM V2595 AS INTEGER
+DIM V2596 AS INTEGER
+DIM V2597 AS INTEGER
+DIM V2598 AS INTEGER
+DIM V2599 AS INTEGER
+DIM V2600 AS INTEGER
+DIM V2601 AS INTEGER
+DIM V2602 AS INTEGER
+DIM V2603 AS INTEGER
+DIM V2604 AS INTEGER
+DIM V2605 AS INTEGER
+DIM V2606 AS INTEGER
+DIM V2607 AS INTEGER
+DIM V2608 AS INTEGER
+DIM V2609 AS INTEGER
+DIM V2610 AS INTEGER
+DIM V2611 AS INTEGER
+DIM V2612 AS INTEGER
+DIM V2613 AS INTEGER
+DIM V2614 AS INTEGER
+DIM V2615 AS INTEGER
+DIM V2616 AS INTEGER
+DIM V2617 AS INTEGER
+DIM V2618 AS INTEGER
+DIM V2619 AS INTEGER
+DIM V2620 AS INTEGER
+DIM V2621 AS INTEGER
+DIM V2622 AS INTEGER
+DIM V2623 AS INTEGER
+DIM V2624 AS INTEGER
+DIM V2625 AS INTEGER
+DIM V2626 AS INTEGER
+DIM V2627 AS INTEGER
+DIM V2628 AS INTEGER
+DIM V2629 AS INTEGER
+DIM V2630 AS INTEGER
+DIM V2631 AS INTEGER
+DIM V2632 AS INTEGER
+DIM V2633 AS INTEGER
+DIM V2634 AS INTEGER
+DIM V2635 AS INTEGER
+DIM V2636 AS INTEGER
+DIM V2637 AS INTEGER
+DIM V2638 AS INTEGER
+DIM V2639 AS INTEGER
+DIM V2640 AS INTEGER
+DIM V2641 AS INTEGER
+DIM V2642 AS INTEGER
+DIM V2643 AS INTEGER
+DIM V2644 AS INTEGER
+DIM V2645 AS INTEGER
+DIM V2646 AS INTEGER
+DIM V2647 AS INTEGER
+DIM V2648 AS INTEGER
+DIM V2649 AS INTEGER
+DIM V2650 AS INTEGER
+DIM V2651 AS INTEGER
+DIM V2652 AS INTEGER
+DIM V2653 AS INTEGER
+DIM V2654 AS INTEGER
+DIM V2655 AS INTEGER
+DIM V2656 AS INTEGER
+DIM V2657 AS INTEGER
+DIM V2658 AS INTEGER
+DIM V2659 AS INTEGER
+DIM V2660 AS INTEGER
+DIM V2661 AS INTEGER
+DIM V2662 AS INTEGER
+DIM V2663 AS INTEGER
+DIM V2664 AS INTEGER
+DIM V2665 AS INTEGER
+DIM V2666 AS INTEGER
+DIM V2667 AS INTEGER
+DIM V2668 AS INTEGER
+DIM V2669 AS INTEGER
+DIM V2670 AS INTEGER
+DIM V2671 AS INTEGER
+DIM V2672 AS INTEGER
+DIM V2673 AS INTEGER
+DIM V2674 AS INTEGER
+DIM V2675 AS INTEGER
+DIM V2676 AS INTEGER
+DIM V2677 AS INTEGER
+DIM V2678 AS INTEGER
+DIM V2679 AS INTEGER
+DIM V2680 AS INTEGER
+DIM V2681 AS INTEGER
+DIM V2682 AS INTEGER
+DIM V2683 AS INTEGER
+DIM V2684 AS INTEGER
+DIM V2685 AS INTEGER
+DIM V2686 AS INTEGER
+DIM V2687 AS INTEGER
+DIM V2688 AS INTEGER
+DIM V2689 AS INTEGER
+DIM V2690 AS INTEGER
+DIM V2691 AS INTEGER
+DIM V2692 AS INTEGER
+DIM V2693 AS INTEGER
+DIM V2694 AS INTEGER
+DIM V2695 AS INTEGER
+DIM V2696 AS INTEGER
+DIM V2697 AS INTEGER
+DIM V2698 AS INTEGER
+DIM V2699 AS INTEGER
+DIM V2700 AS INTEGER
+DIM V2701 AS INTEGER
+DIM V2702 AS INTEGER
+DIM V2703 AS INTEGER
+DIM V2704 AS INTEGER
+DIM V2705 AS INTEGER
+DIM V2706 AS INTEGER
+DIM V2707 AS INTEGER
+DIM V2708 AS INTEGER
+DIM V2709 AS INTEGER
+DIM V2710 AS INTEGER
+DIM V2711 AS INTEGER
+DIM V2712 AS INTEGER
+DIM V2713 AS INTEGER
+DIM V2714 AS INTEGER
+DIM V2715 AS INTEGER
+DIM V2716 AS INTEGER
+DIM V2717 AS INTEGER
+DIM V2718 AS INTEGER
+DIM V2719 AS INTEGER
+DIM V2720 AS INTEGER
+DIM V2721 AS INTEGER
+DIM V2722 AS INTEGER
+DIM V2723 AS INTEGER
+DIM V2724 AS INTEGER
+DIM V2725 AS INTEGER
+DIM V2726 AS INTEGER
+DIM V2727 AS INTEGER
+DIM V2728 AS INTEGER
+DIM V2729 AS INTEGER
+DIM V2730 AS INTEGER
+DIM V2731 AS INTEGER
+DIM V2732 AS INTEGER
+DIM V2733 AS INTEGER
+DIM V2734 AS INTEGER
+DIM V2735 AS INTEGER
+DIM V2736 AS INTEGER
+DIM V2737 AS INTEGER
+DIM V2738 AS INTEGER
+DIM V2739 AS INTEGER
+DIM V2740 AS INTEGER
+DIM V2741 AS INTEGER
+DIM V2742 AS INTEGER
+DIM V2743 AS INTEGER
+DIM V2744 AS INTEGER
+DIM V2745 AS INTEGER
+DIM V2746 AS INTEGER
+DIM V2747 AS INTEGER
+DIM V2748 AS INTEGER
+DIM V2749 AS INTEGER
+DIM V2750 AS INTEGER
+DIM V2751 AS INTEGER
+DIM V2752 AS INTEGER
+DIM V2753 AS INTEGER
+DIM V2754 AS INTEGER
+DIM V2755 AS INTEGER
+DIM V2756 AS INTEGER
+DIM V2757 AS INTEGER
+DIM V2758 AS INTEGER
+DIM V2759 AS INTEGER
+DIM V2760 AS INTEGER
+DIM V2761 AS INTEGER
+DIM V2762 AS INTEGER
+DIM V2763 AS INTEGER
+DIM V2764 AS INTEGER
+DIM V2765 AS INTEGER
+DIM V2766 AS INTEGER
+DIM V2767 AS INTEGER
+DIM V2768 AS INTEGER
+DIM V2769 AS INTEGER
+DIM V2770 AS INTEGER
+DIM V2771 AS INTEGER
+DIM V2772 AS INTEGER
+DIM V2773 AS INTEGER
+DIM V2774 AS INTEGER
+DIM V2775 AS INTEGER
+DIM V2776 AS INTEGER
+DIM V2777 AS INTEGER
+DIM V2778 AS INTEGER
+DIM V2779 AS INTEGER
+DIM V2780 AS INTEGER
+DIM V2781 AS INTEGER
+DIM V2782 AS INTEGER
+DIM V2783 AS INTEGER
+DIM V2784 AS INTEGER
+DIM V2785 AS INTEGER
+DIM V2786 AS INTEGER
+DIM V2787 AS INTEGER
+DIM V2788 AS INTEGER
+DIM V2789 AS INTEGER
+DIM V2790 AS INTEGER
+DIM V2791 AS INTEGER
+DIM V2792 AS INTEGER
+DIM V2793 AS INTEGER
+DIM V2794 AS INTEGER
+DIM V2795 AS INTEGER
+DIM V2796 AS INTEGER
+DIM V2797 AS INTEGER
+DIM V2798 AS INTEGER
+DIM V2799 AS INTEGER
+DIM V2800 AS INTEGER
+DIM V2801 AS INTEGER
+DIM V2802 AS INTEGER
+DIM V2803 AS INTEGER
+DIM V2804 AS INTEGER
+DIM V2805 AS INTEGER
+DIM V2806 AS INTEGER
+DIM V2807 AS INTEGER
+DIM V2808 AS INTEGER
+DIM V2809 AS INTEGER
+DIM V2810 AS INTEGER
+DIM V2811 AS INTEGER
+DIM V2812 AS INTEGER
+DIM V2813 AS INTEGER
+DIM V2814 AS INTEGER
+DIM V2815 AS INTEGER
+DIM V2816 AS INTEGER
+DIM V2817 AS INTEGER
+DIM V2818 AS INTEGER
+DIM V2819 AS INTEGER
+DIM V2820 AS INTEGER
+DIM V2821 AS INTEGER
+DIM V2822 AS INTEGER
+DIM V2823 AS INTEGER
+DIM V2824 AS INTEGER
+DIM V2825 AS INTEGER
+DIM V2826 AS INTEGER
+DIM V2827 AS INTEGER
+DIM V2828 AS INTEGER
+DIM V2829 AS INTEGER
+DIM V2830 AS INTEGER
+DIM V2831 AS INTEGER
+DIM V2832 AS INTEGER
+DIM V2833 AS INTEGER
+DIM V2834 AS INTEGER
+DIM V2835 AS INTEGER
+DIM V2836 AS INTEGER
+DIM V2837 AS INTEGER
+DIM V2838 AS INTEGER
+DIM V2839 AS INTEGER
+DIM V2840 AS INTEGER
+DIM V2841 AS INTEGER
+DIM V2842 AS INTEGER
+DIM V2843 AS INTEGER
+DIM V2844 AS INTEGER
+DIM V2845 AS INTEGER
+DIM V2846 AS INTEGER
+DIM V2847 AS INTEGER
+DIM V2848 AS INTEGER
+DIM V2849 AS INTEGER
+DIM V2850 AS INTEGER
+DIM V2851 AS INTEGER
+DIM V2852 AS INTEGER
+DIM V2853 AS INTEGER
+DIM V2854 AS INTEGER
+DIM V2855 AS INTEGER
+DIM V2856 AS INTEGER
+DIM V2857 AS INTEGER
+DIM V2858 AS INTEGER
+DIM V2859 AS INTEGER
+DIM V2860 AS INTEGER
+DIM V2861 AS INTEGER
+DIM V2862 AS INTEGER
+DIM V2863 AS INTEGER
+DIM V2864 AS INTEGER
+DIM V2865 AS INTEGER
+DIM V2866 AS INTEGER
+DIM V2867 AS INTEGER
+DIM V2868 AS INTEGER
+DIM V2869 AS INTEGER
+DIM V2870 AS INTEGER
+DIM V2871 AS INTEGER
+DIM V2872 AS INTEGER
+DIM V2873 AS INTEGER
+DIM V2874 AS INTEGER
+DIM V2875 AS INTEGER
+DIM V2876 AS INTEGER
+DIM V2877 AS INTEGER
+DIM V2878 AS INTEGER
+DIM V2879 AS INTEGER
+DIM V2880 AS INTEGER
+DIM V2881 AS INTEGER
+DIM V2882 AS INTEGER
+DIM V2883 AS INTEGER
+DIM V2884 AS INTEGER
+DIM V2885 AS INTEGER
+DIM V2886 AS INTEGER
+DIM V2887 AS INTEGER
+DIM V2888 AS INTEGER
+DIM V2889 AS INTEGER
+DIM V2890 AS INTEGER
+DIM V2891 AS INTEGER
+DIM V2892 AS INTEGER
+DIM V2893 AS INTEGER
+DIM V2894 AS INTEGER
+DIM V2895 AS INTEGER
+DIM V2896 AS INTEGER
+DIM V2897 AS INTEGER
+DIM V2898 AS INTEGER
+DIM V2899 AS INTEGER
+DIM V2900 AS INTEGER
+DIM V2901 AS INTEGER
+DIM V2902 AS INTEGER
+DIM V2903 AS INTEGER
+DIM V2904 AS INTEGER
+DIM V2905 AS INTEGER
+DIM V2906 AS INTEGER
+DIM V2907 AS INTEGER
+DIM V2908 AS INTEGER
+DIM V2909 AS INTEGER
+DIM V2910 AS INTEGER
+DIM V2911 AS INTEGER
+DIM V2912 AS INTEGER
+DIM V2913 AS INTEGER
+DIM V2914 AS INTEGER
+DIM V2915 AS INTEGER
+DIM V2916 AS INTEGER
+DIM V2917 AS INTEGER
+DIM V2918 AS INTEGER
+DIM V2919 AS INTEGER
+DIM V2920 AS INTEGER
+DIM V2921 AS INTEGER
+DIM V2922 AS INTEGER
+DIM V2923 AS INTEGER
+DIM V2924 AS INTEGER
+DIM V2925 AS INTEGER
+DIM V2926 AS INTEGER
+DIM V2927 AS INTEGER
+DIM V2928 AS INTEGER
+DIM V2929 AS INTEGER
+DIM V2930 AS INTEGER
+DIM V2931 AS INTEGER
+DIM V2932 AS INTEGER
+DIM V2933 AS INTEGER
+DIM V2934 AS INTEGER
+DIM V2935 AS INTEGER
+DIM V2936 AS INTEGER
+DIM V2937 AS INTEGER
+DIM V2938 AS INTEGER
+DIM V2939 AS INTEGER
+DIM V2940 AS INTEGER
+DIM V2941 AS INTEGER
+DIM V2942 AS INTEGER
+DIM V2943 AS INTEGER
+DIM V2944 AS INTEGER
+DIM V2945 AS INTEGER
+DIM V2946 AS INTEGER
+DIM V2947 AS INTEGER
+DIM V2948 AS INTEGER
+DIM V2949 AS INTEGER
+DIM V2950 AS INTEGER
+DIM V2951 AS INTEGER
+DIM V2952 AS INTEGER
+DIM V2953 AS INTEGER
+DIM V2954 AS INTEGER
+DIM V2955 AS INTEGER
+DIM V2956 AS INTEGER
+DIM V2957 AS INTEGER
+DIM V2958 AS INTEGER
+DIM V2959 AS INTEGER
+DIM V2960 AS INTEGER
+DIM V2961 AS INTEGER
+DIM V2962 AS INTEGER
+DIM V2963 AS INTEGER
+DIM V2964 AS INTEGER
+DIM V2965 AS INTEGER
+DIM V2966 AS INTEGER
+DIM V2967 AS INTEGER
+DIM V2968 AS INTEGER
+DIM V2969 AS INTEGER
+DIM V2970 AS INTEGER
+DIM V2971 AS INTEGER
+DIM V2972 AS INTEGER
+DIM V2973 AS INTEGER
+DIM V2974 AS INTEGER
+DIM V2975 AS INTEGER
+DIM V2976 AS INTEGER
+DIM V2977 AS INTEGER
+DIM V2978 AS INTEGER
+DIM V2979 AS INTEGER
+DIM V2980 AS INTEGER
+DIM V2981 AS INTEGER
+DIM V2982 AS INTEGER
+DIM V2983 AS INTEGER
+DIM V2984 AS INTEGER
+DIM V2985 AS INTEGER
+DIM V2986 AS INTEGER
+DIM V2987 AS INTEGER
+DIM V2988 AS INTEGER
+DIM V2989 AS INTEGER
+DIM V2990 AS INTEGER
+DIM V2991 AS INTEGER
+DIM V2992 AS INTEGER
+DIM V2993 AS INTEGER
+DIM V2994 AS INTEGER
+DIM V2995 AS INTEGER
+DIM V2996 AS INTEGER
+DIM V2997 AS INTEGER
+DIM V2998 AS INTEGER
+DIM V2999 AS INTEGER
+DIM V3000 AS INTEGER
+DIM V3001 AS INTEGER
+DIM V3002 AS INTEGER
+DIM V3003 AS INTEGER
+DIM V3004 AS INTEGER
+DIM V3005 AS INTEGER
+DIM V3006 AS INTEGER
+DIM V3007 AS INTEGER
+DIM V3008 AS INTEGER
+DIM V3009 AS INTEGER
+DIM V3010 AS INTEGER
+DIM V3011 AS INTEGER
+DIM V3012 AS INTEGER
+DIM V3013 AS INTEGER
+DIM V3014 AS INTEGER
+DIM V3015 AS INTEGER
+DIM V3016 AS INTEGER
+DIM V3017 AS INTEGER
+DIM V3018 AS INTEGER
+DIM V3019 AS INTEGER
+DIM V3020 AS INTEGER
+DIM V3021 AS INTEGER
+DIM V3022 AS INTEGER
+DIM V3023 AS INTEGER
+DIM V3024 AS INTEGER
+DIM V3025 AS INTEGER
+DIM V3026 AS INTEGER
+DIM V3027 AS INTEGER
+DIM V3028 AS INTEGER
+DIM V3029 AS INTEGER
+DIM V3030 AS INTEGER
+DIM V3031 AS INTEGER
+DIM V3032 AS INTEGER
+DIM V3033 AS INTEGER
+DIM V3034 AS INTEGER
+DIM V3035 AS INTEGER
+DIM V3036 AS INTEGER
+DIM V3037 AS INTEGER
+DIM V3038 AS INTEGER
+DIM V3039 AS INTEGER
+DIM V3040 AS INTEGER
+DIM V3041 AS INTEGER
+DIM V3042 AS INTEGER
+DIM V3043 AS INTEGER
+DIM V3044 AS INTEGER
+DIM V3045 AS INTEGER
+DIM V3046 AS INTEGER
+DIM V3047 AS INTEGER
+DIM V3048 AS INTEGER
+DIM V3049 AS INTEGER
+DIM V3050 AS INTEGER
+DIM V3051 AS INTEGER
+DIM V3052 AS INTEGER
+DIM V3053 AS INTEGER
+DIM V3054 AS INTEGER
+DIM V3055 AS INTEGER
+DIM V3056 AS INTEGER
+DIM V3057 AS INTEGER
+DIM V3058 AS INTEGER
+DIM V3059 AS INTEGER
+DIM V3060 AS INTEGER
+DIM V3061 AS INTEGER
+DIM V3062 AS INTEGER
+DIM V3063 AS INTEGER
+DIM V3064 AS INTEGER
+DIM V3065 AS INTEGER
+DIM V3066 AS INTEGER
+DIM V3067 AS INTEGER
+DIM V3068 AS INTEGER
+DIM V3069 AS INTEGER
+DIM V3070 AS INTEGER
+DIM V3071 AS INTEGER
+DIM V3072 AS INTEGER
+DIM V3073 AS INTEGER
+DIM V3074 AS INTEGER
+DIM V3075 AS INTEGER
+DIM V3076 AS INTEGER
+DIM V3077 AS INTEGER
+DIM V3078 AS INTEGER
+DIM V3079 AS INTEGER
+DIM V3080 AS INTEGER
+DIM V3081 AS INTEGER
+DIM V3082 AS INTEGER
+DIM V3083 AS INTEGER
+DIM V3084 AS INTEGER
+DIM V3085 AS INTEGER
+DIM V3086 AS INTEGER
+DIM V3087 AS INTEGER
+DIM V3088 AS INTEGER
+DIM V3089 AS INTEGER
+DIM V3090 AS INTEGER
+DIM V3091 AS INTEGER
+DIM V3092 AS INTEGER
+DIM V3093 AS INTEGER
+DIM V3094 AS INTEGER
+DIM V3095 AS INTEGER
+DIM V3096 AS INTEGER
+DIM V3097 AS INTEGER
+DIM V3098 AS INTEGER
+DIM V3099 AS INTEGER
+DIM V3100 AS INTEGER
+DIM V3101 AS INTEGER
+DIM V3102 AS INTEGER
+DIM V3103 AS INTEGER
+DIM V3104 AS INTEGER
+DIM V3105 AS INTEGER
+DIM V3106 AS INTEGER
+DIM V3107 AS INTEGER
+DIM V3108 AS INTEGER
+DIM V3109 AS INTEGER
+DIM V3110 AS INTEGER
+DIM V3111 AS INTEGER
+DIM V3112 AS INTEGER
+DIM V3113 AS INTEGER
+DIM V3114 AS INTEGER
+DIM V3115 AS INTEGER
+DIM V3116 AS INTEGER
+DIM V3117 AS INTEGER
+DIM V3118 AS INTEGER
+DIM V3119 AS INTEGER
+DIM V3120 AS INTEGER
+DIM V3121 AS INTEGER
+DIM V3122 AS INTEGER
+DIM V3123 AS INTEGER
+DIM V3124 AS INTEGER
+DIM V3125 AS INTEGER
+DIM V3126 AS INTEGER
+DIM V3127 AS INTEGER
+DIM V3128 AS INTEGER
+DIM V3129 AS INTEGER
+DIM V3130 AS INTEGER
+DIM V3131 AS INTEGER
+DIM V3132 AS INTEGER
+DIM V3133 AS INTEGER
+DIM V3134 AS INTEGER
+DIM V3135 AS INTEGER
+DIM V3136 AS INTEGER
+DIM V3137 AS INTEGER
+DIM V3138 AS INTEGER
+DIM V3139 AS INTEGER
+DIM V3140 AS INTEGER
+DIM V3141 AS INTEGER
+DIM V3142 AS INTEGER
+DIM V3143 AS INTEGER
+DIM V3144 AS INTEGER
+DIM V3145 AS INTEGER
+DIM V3146 AS INTEGER
+DIM V3147 AS INTEGER
+DIM V3148 AS INTEGER
+DIM V3149 AS INTEGER
+DIM V3150 AS INTEGER
+DIM V3151 AS INTEGER
+DIM V3152 AS INTEGER
+DIM V3153 AS INTEGER
+DIM V3154 AS INTEGER
+DIM V3155 AS INTEGER
+DIM V3156 AS INTEGER
+DIM V3157 AS INTEGER
+DIM V3158 AS INTEGER
+DIM V3159 AS INTEGER
+DIM V3160 AS INTEGER
+DIM V3161 AS INTEGER
+DIM V3162 AS INTEGER
+DIM V3163 AS INTEGER
+DIM V3164 AS INTEGER
+DIM V3165 AS INTEGER
+DIM V3166 AS INTEGER
+DIM V3167 AS INTEGER
+DIM V3168 AS INTEGER
+DIM V3169 AS INTEGER
+DIM V3170 AS INTEGER
+DIM V3171 AS INTEGER
+DIM V3172 AS INTEGER
+DIM V3173 AS INTEGER
+DIM V3174 AS INTEGER
+DIM V3175 AS INTEGER
+DIM V3176 AS INTEGER
+DIM V3177 AS INTEGER
+DIM V3178 AS INTEGER
+DIM V3179 AS INTEGER
+DIM V3180 AS INTEGER
+DIM V3181 AS INTEGER
+DIM V3182 AS INTEGER
+DIM V3183 AS INTEGER
+DIM V3184 AS INTEGER
+DIM V3185 AS INTEGER
+DIM V3186 AS INTEGER
+DIM V3187 AS INTEGER
+DIM V3188 AS INTEGER
+DIM V3189 AS INTEGER
+DIM V3190 AS INTEGER
+DIM V3191 AS INTEGER
+DIM V3192 AS INTEGER
+DIM V3193 AS INTEGER
+DIM V3194 AS INTEGER
+DIM V3195 AS INTEGER
+DIM V3196 AS INTEGER
+DIM V3197 AS INTEGER
+DIM V3198 AS INTEGER
+DIM V3199 AS INTEGER
+DIM V3200 AS INTEGER
+DIM V3201 AS INTEGER
+DIM V3202 AS INTEGER
+DIM V3203 AS INTEGER
+DIM V3204 AS INTEGER
+DIM V3205 AS INTEGER
+DIM V3206 AS INTEGER
+DIM V3207 AS INTEGER
+DIM V3208 AS INTEGER
+DIM V3209 AS INTEGER
+DIM V3210 AS INTEGER
+DIM V3211 AS INTEGER
+DIM V3212 AS INTEGER
+DIM V3213 AS INTEGER
+DIM V3214 AS INTEGER
+DIM V3215 AS INTEGER
+DIM V3216 AS INTEGER
+DIM V3217 AS INTEGER
+DIM V3218 AS INTEGER
+DIM V3219 AS INTEGER
+DIM V3220 AS INTEGER
+DIM V3221 AS INTEGER
+DIM V3222 AS INTEGER
+DIM V3223 AS INTEGER
+DIM V3224 AS INTEGER
+DIM V3225 AS INTEGER
+DIM V3226 AS INTEGER
+DIM V3227 AS INTEGER
+DIM V3228 AS INTEGER
+DIM V3229 AS INTEGER
+DIM V3230 AS INTEGER
+DIM V3231 AS INTEGER
+DIM V3232 AS INTEGER
+DIM V3233 AS INTEGER
+DIM V3234 AS INTEGER
+DIM V3235 AS INTEGER
+DIM V3236 AS INTEGER
+DIM V3237 AS INTEGER
+DIM V3238 AS INTEGER
+DIM V3239 AS INTEGER
+DIM V3240 AS INTEGER
+DIM V3241 AS INTEGER
+DIM V3242 AS INTEGER
+DIM V3243 AS INTEGER
+DIM V3244 AS INTEGER
+DIM V3245 AS INTEGER
+DIM V3246 AS INTEGER
+DIM V3247 AS INTEGER
+DIM V3248 AS INTEGER
+DIM V3249 AS INTEGER
+DIM V3250 AS INTEGER
+DIM V3251 AS INTEGER
+DIM V3252 AS INTEGER
+DIM V3253 AS INTEGER
+DIM V3254 AS INTEGER
+DIM V3255 AS INTEGER
+DIM V3256 AS INTEGER
+DIM V3257 AS INTEGER
+DIM V3258 AS INTEGER
+DIM V3259 AS INTEGER
+DIM V3260 AS INTEGER
+DIM V3261 AS INTEGER
+DIM V3262 AS INTEGER
+DIM V3263 AS INTEGER
+DIM V3264 AS INTEGER
+DIM V3265 AS INTEGER
+DIM V3266 AS INTEGER
+DIM V3267 AS INTEGER
+DIM V3268 AS INTEGER
+DIM V3269 AS INTEGER
+DIM V3270 AS INTEGER
+DIM V3271 AS INTEGER
+DIM V3272 AS INTEGER
+DIM V3273 AS INTEGER
+DIM V3274 AS INTEGER
+DIM V3275 AS INTEGER
+DIM V3276 AS INTEGER
+DIM V3277 AS INTEGER
+DIM V3278 AS INTEGER
+DIM V3279 AS INTEGER
+DIM V3280 AS INTEGER
+DIM V3281 AS INTEGER
+DIM V3282 AS INTEGER
+DIM V3283 AS INTEGER
+DIM V3284 AS INTEGER
+DIM V3285 AS INTEGER
+DIM V3286 AS INTEGER
+DIM V3287 AS INTEGER
+DIM V3288 AS INTEGER
+DIM V3289 AS INTEGER
+DIM V3290 AS INTEGER
+DIM V3291 AS INTEGER
+DIM V3292 AS INTEGER
+DIM V3293 AS INTEGER
+DIM V3294 AS INTEGER
+DIM V3295 AS INTEGER
+DIM V3296 AS INTEGER
+DIM V3297 AS INTEGER
+DIM V3298 AS INTEGER
+DIM V3299 AS INTEGER
+DIM V3300 AS INTEGER
+DIM V3301 AS INTEGER
+DIM V3302 AS INTEGER
+DIM V3303 AS INTEGER
+DIM V3304 AS INTEGER
+DIM V3305 AS INTEGER
+DIM V3306 AS INTEGER
+DIM V3307 AS INTEGER
+DIM V3308 AS INTEGER
+DIM V3309 AS INTEGER
+DIM V3310 AS INTEGER
+DIM V3311 AS INTEGER
+DIM V3312 AS INTEGER
+DIM V3313 AS INTEGER
+DIM V3314 AS INTEGER
+DIM V3315 AS INTEGER
+DIM V3316 AS INTEGER
+DIM V3317 AS INTEGER
+DIM V3318 AS INTEGER
+DIM V3319 AS INTEGER
+DIM V3320 AS INTEGER
+DIM V3321 AS INTEGER
+DIM V3322 AS INTEGER
+DIM V3323 AS INTEGER
+DIM V3324 AS INTEGER
+DIM V3325 AS INTEGER
+DIM V3326 AS INTEGER
+DIM V3327 AS INTEGER
+DIM V3328 AS INTEGER
+DIM V3329 AS INTEGER
+DIM V3330 AS INTEGER
+DIM V3331 AS INTEGER
+DIM V3332 AS INTEGER
+DIM V3333 AS INTEGER
+DIM V3334 AS INTEGER
+DIM V3335 AS INTEGER
+DIM V3336 AS INTEGER
+DIM V3337 AS INTEGER
+DIM V3338 AS INTEGER
+DIM V3339 AS INTEGER
+DIM V3340 AS INTEGER
+DIM V3341 AS INTEGER
+DIM V3342 AS INTEGER
+DIM V3343 AS INTEGER
+DIM V3344 AS INTEGER
+DIM V3345 AS INTEGER
+DIM V3346 AS INTEGER
+DIM V3347 AS INTEGER
+DIM V3348 AS INTEGER
+DIM V3349 AS INTEGER
+DIM V3350 AS INTEGER
+DIM V3351 AS INTEGER
+DIM V3352 AS INTEGER
+DIM V3353 AS INTEGER
+DIM V3354 AS INTEGER
+DIM V3355 AS INTEGER
+DIM V3356 AS INTEGER
+DIM V3357 AS INTEGER
+DIM V3358 AS INTEGER
+DIM V3359 AS INTEGER
+DIM V3360 AS INTEGER
+DIM V3361 AS INTEGER
+DIM V3362 AS INTEGER
+DIM V3363 AS INTEGER
+DIM V3364 AS INTEGER
+DIM V3365 AS INTEGER
+DIM V3366 AS INTEGER
+DIM V3367 AS INTEGER
+DIM V3368 AS INTEGER
+DIM V3369 AS INTEGER
+DIM V3370 AS INTEGER
+DIM V3371 AS INTEGER
+DIM V3372 AS INTEGER
+DIM V3373 AS INTEGER
+DIM V3374 AS INTEGER
+DIM V3375 AS INTEGER
+DIM V3376 AS INTEGER
+DIM V3377 AS INTEGER
+DIM V3378 AS INTEGER
+DIM V3379 AS INTEGER
+DIM V3380 AS INTEGER
+DIM V3381 AS INTEGER
+DIM V3382 AS INTEGER
+DIM V3383 AS INTEGER
+DIM V3384 AS INTEGER
+DIM V3385 AS INTEGER
+DIM V3386 AS INTEGER
+DIM V3387 AS INTEGER
+DIM V3388 AS INTEGER
+DIM V3389 AS INTEGER
+DIM V3390 AS INTEGER
+DIM V3391 AS INTEGER
+DIM V3392 AS INTEGER
+DIM V3393 AS INTEGER
+DIM V3394 AS INTEGER
+DIM V3395 AS INTEGER
+DIM V3396 AS INTEGER
+DIM V3397 AS INTEGER
+DIM V3398 AS INTEGER
+DIM V3399 AS INTEGER
+DIM V3400 AS INTEGER
+DIM V3401 AS INTEGER
+DIM V3402 AS INTEGER
+DIM V3403 AS INTEGER
+DIM V3404 AS INTEGER
+DIM V3405 AS INTEGER
+DIM V3406 AS INTEGER
+DIM V3407 AS INTEGER
+DIM V3408 AS INTEGER
+DIM V3409 AS INTEGER
+DIM V3410 AS INTEGER
+DIM V3411 AS INTEGER
+DIM V3412 AS INTEGER
+DIM V3413 AS INTEGER
+DIM V3414 AS INTEGER
+DIM V3415 AS INTEGER
+DIM V3416 AS INTEGER
+DIM V3417 AS INTEGER
+DIM V3418 AS INTEGER
+DIM V3419 AS INTEGER
+DIM V3420 AS INTEGER
+DIM V3421 AS INTEGER
+DIM V3422 AS INTEGER
+DIM V3423 AS INTEGER
+DIM V3424 AS INTEGER
+DIM V3425 AS INTEGER
+DIM V3426 AS INTEGER
+DIM V3427 AS INTEGER
+DIM V3428 AS INTEGER
+DIM V3429 AS INTEGER
+DIM V3430 AS INTEGER
+DIM V3431 AS INTEGER
+DIM V3432 AS INTEGER
+DIM V3433 AS INTEGER
+DIM V3434 AS INTEGER
+DIM V3435 AS INTEGER
+DIM V3436 AS INTEGER
+DIM V3437 AS INTEGER
+DIM V3438 AS INTEGER
+DIM V3439 AS INTEGER
+DIM V3440 AS INTEGER
+DIM V3441 AS INTEGER
+DIM V3442 AS INTEGER
+DIM V3443 AS INTEGER
+DIM V3444 AS INTEGER
+DIM V3445 AS INTEGER
+DIM V3446 AS INTEGER
+DIM V3447 AS INTEGER
+DIM V3448 AS INTEGER
+DIM V3449 AS INTEGER
+DIM V3450 AS INTEGER
+DIM V3451 AS INTEGER
+DIM V3452 AS INTEGER
+DIM V3453 AS INTEGER
+DIM V3454 AS INTEGER
+DIM V3455 AS INTEGER
+DIM V3456 AS INTEGER
+DIM V3457 AS INTEGER
+DIM V3458 AS INTEGER
+DIM V3459 AS INTEGER
+DIM V3460 AS INTEGER
+DIM V3461 AS INTEGER
+DIM V3462 AS INTEGER
+DIM V3463 AS INTEGER
+DIM V3464 AS INTEGER
+DIM V3465 AS INTEGER
+DIM V3466 AS INTEGER
+DIM V3467 AS INTEGER
+DIM V3468 AS INTEGER
+DIM V3469 AS INTEGER
+DIM V3470 AS INTEGER
+DIM V3471 AS INTEGER
+DIM V3472 AS INTEGER
+DIM V3473 AS INTEGER
+DIM V3474 AS INTEGER
+DIM V3475 AS INTEGER
+DIM V3476 AS INTEGER
+DIM V3477 AS INTEGER
+DIM V3478 AS INTEGER
+DIM V3479 AS INTEGER
+DIM V3480 AS INTEGER
+DIM V3481 AS INTEGER
+DIM V3482 AS INTEGER
+DIM V3483 AS INTEGER
+DIM V3484 AS INTEGER
+DIM V3485 AS INTEGER
+DIM V3486 AS INTEGER
+DIM V3487 AS INTEGER
+DIM V3488 AS INTEGER
+DIM V3489 AS INTEGER
+DIM V3490 AS INTEGER
+DIM V3491 AS INTEGER
+DIM V3492 AS INTEGER
+DIM V3493 AS INTEGER
+DIM V3494 AS INTEGER
+DIM V3495 AS INTEGER
+DIM V3496 AS INTEGER
+DIM V3497 AS INTEGER
+DIM V3498 AS INTEGER
+DIM V3499 AS INTEGER
+DIM V3500 AS INTEGER
+DIM V3501 AS INTEGER
+DIM V3502 AS INTEGER
+DIM V3503 AS INTEGER
+DIM V3504 AS INTEGER
+DIM V3505 AS INTEGER
+DIM V3506 AS INTEGER
+DIM V3507 AS INTEGER
+DIM V3508 AS INTEGER
+DIM V3509 AS INTEGER
+DIM V3510 AS INTEGER
+DIM V3511 AS INTEGER
+DIM V3512 AS INTEGER
+DIM V3513 AS INTEGER
+DIM V3514 AS INTEGER
+DIM V3515 AS INTEGER
+DIM V3516 AS INTEGER
+DIM V3517 AS INTEGER
+DIM V3518 AS INTEGER
+DIM V3519 AS INTEGER
+DIM V3520 AS INTEGER
+DIM V3521 AS INTEGER
+DIM V3522 AS INTEGER
+DIM V3523 AS INTEGER
+DIM V3524 AS INTEGER
+DIM V3525 AS INTEGER
+DIM V3526 AS INTEGER
+DIM V3527 AS INTEGER
+DIM V3528 AS INTEGER
+DIM V3529 AS INTEGER
+DIM V3530 AS INTEGER
+DIM V3531 AS INTEGER
+DIM V3532 AS INTEGER
+DIM V3533 AS INTEGER
+DIM V3534 AS INTEGER
+DIM V3535 AS INTEGER
+DIM V3536 AS INTEGER
+DIM V3537 AS INTEGER
+DIM V3538 AS INTEGER
+DIM V3539 AS INTEGER
+DIM V3540 AS INTEGER
+DIM V3541 AS INTEGER
+DIM V3542 AS INTEGER
+DIM V3543 AS INTEGER
+DIM V3544 AS INTEGER
+DIM V3545 AS INTEGER
+DIM V3546 AS INTEGER
+DIM V3547 AS INTEGER
+DIM V3548 AS INTEGER
+DIM V3549 AS INTEGER
+DIM V3550 AS INTEGER
+DIM V3551 AS INTEGER
+DIM V3552 AS INTEGER
+DIM V3553 AS INTEGER
+DIM V3554 AS INTEGER
+DIM V3555 AS INTEGER
+DIM V3556 AS INTEGER
+DIM V3557 AS INTEGER
+DIM V3558 AS INTEGER
+DIM V3559 AS INTEGER
+DIM V3560 AS INTEGER
+DIM V3561 AS INTEGER
+DIM V3562 AS INTEGER
+DIM V3563 AS INTEGER
+DIM V3564 AS INTEGER
+DIM V3565 AS INTEGER
+DIM V3566 AS INTEGER
+DIM V3567 AS INTEGER
+DIM V3568 AS INTEGER
+DIM V3569 AS INTEGER
+DIM V3570 AS INTEGER
+DIM V3571 AS INTEGER
+DIM V3572 AS INTEGER
+DIM V3573 AS INTEGER
+DIM V3574 AS INTEGER
+DIM V3575 AS INTEGER
+DIM V3576 AS INTEGER
+DIM V3577 AS INTEGER
+DIM V3578 AS INTEGER
+DIM V3579 AS INTEGER
+DIM V3580 AS INTEGER
+DIM V3581 AS INTEGER
+DIM V3582 AS INTEGER
+DIM V3583 AS INTEGER
+DIM V3584 AS INTEGER
+DIM V3585 AS INTEGER
+DIM V3586 AS INTEGER
+DIM V3587 AS INTEGER
+DIM V3588 AS INTEGER
+DIM V3589 AS INTEGER
+DIM V3590 AS INTEGER
+DIM V3591 AS INTEGER
+DIM V3592 AS INTEGER
+DIM V3593 AS INTEGER
+DIM V3594 AS INTEGER
+DIM V3595 AS INTEGER
+DIM V3596 AS INTEGER
+DIM V3597 AS INTEGER
+DIM V3598 AS INTEGER
+DIM V3599 AS INTEGER
+DIM V3600 AS INTEGER
+DIM V3601 AS INTEGER
+DIM V3602 AS INTEGER
+DIM V3603 AS INTEGER
+DIM V3604 AS INTEGER
+DIM V3605 AS INTEGER
+DIM V3606 AS INTEGER
+DIM V3607 AS INTEGER
+DIM V3608 AS INTEGER
+DIM V3609 AS INTEGER
+DIM V3610 AS INTEGER
+DIM V3611 AS INTEGER
+DIM V3612 AS INTEGER
+DIM V3613 AS INTEGER
+DIM V3614 AS INTEGER
+DIM V3615 AS INTEGER
+DIM V3616 AS INTEGER
+DIM V3617 AS INTEGER
+DIM V3618 AS INTEGER
+DIM V3619 AS INTEGER
+DIM V3620 AS INTEGER
+DIM V3621 AS INTEGER
+DIM V3622 AS INTEGER
+DIM V3623 AS INTEGER
+DIM V3624 AS INTEGER
+DIM V3625 AS INTEGER
+DIM V3626 AS INTEGER
+DIM V3627 AS INTEGER
+DIM V3628 AS INTEGER
+DIM V3629 AS INTEGER
+DIM V3630 AS INTEGER
+DIM V3631 AS INTEGER
+DIM V3632 AS INTEGER
+DIM V3633 AS INTEGER
+DIM V3634 AS INTEGER
+DIM V3635 AS INTEGER
+DIM V3636 AS INTEGER
+DIM V3637 AS INTEGER
+DIM V3638 AS INTEGER
+DIM V3639 AS INTEGER
+DIM V3640 AS INTEGER
+DIM V3641 AS INTEGER
+DIM V3642 AS INTEGER
+DIM V3643 AS INTEGER
+DIM V3644 AS INTEGER
+DIM V3645 AS INTEGER
+DIM V3646 AS INTEGER
+DIM V3647 AS INTEGER
+DIM V3648 AS INTEGER
+DIM V3649 AS INTEGER
+DIM V3650 AS INTEGER
+DIM V3651 AS INTEGER
+DIM V3652 AS INTEGER
+DIM V3653 AS INTEGER
+DIM V3654 AS INTEGER
+DIM V3655 AS INTEGER
+DIM V3656 AS INTEGER
+DIM V3657 AS INTEGER
+DIM V3658 AS INTEGER
+DIM V3659 AS INTEGER
+DIM V3660 AS INTEGER
+DIM V3661 AS INTEGER
+DIM V3662 AS INTEGER
+DIM V3663 AS INTEGER
+DIM V3664 AS INTEGER
+DIM V3665 AS INTEGER
+DIM V3666 AS INTEGER
+DIM V3667 AS INTEGER
+DIM V3668 AS INTEGER
+DIM V3669 AS INTEGER
+DIM V3670 AS INTEGER
+DIM V3671 AS INTEGER
+DIM V3672 AS INTEGER
+DIM V3673 AS INTEGER
+DIM V3674 AS INTEGER
+DIM V3675 AS INTEGER
+DIM V3676 AS INTEGER
+DIM V3677 AS INTEGER
+DIM V3678 AS INTEGER
+DIM V3679 AS INTEGER
+DIM V3680 AS INTEGER
+DIM V3681 AS INTEGER
+DIM V3682 AS INTEGER
+DIM V3683 AS INTEGER
+DIM V3684 AS INTEGER
+DIM V3685 AS INTEGER
+DIM V3686 AS INTEGER
+DIM V3687 AS INTEGER
+DIM V3688 AS INTEGER
+DIM V3689 AS INTEGER
+DIM V3690 AS INTEGER
+DIM V3691 AS INTEGER
+DIM V3692 AS INTEGER
+DIM V3693 AS INTEGER
+DIM V3694 AS INTEGER
+DIM V3695 AS INTEGER
+DIM V3696 AS INTEGER
+DIM V3697 AS INTEGER
+DIM V3698 AS INTEGER
+DIM V3699 AS INTEGER
+DIM V3700 AS INTEGER
+DIM V3701 AS INTEGER
+DIM V3702 AS INTEGER
+DIM V3703 AS INTEGER
+DIM V3704 AS INTEGER
+DIM V3705 AS INTEGER
+DIM V3706 AS INTEGER
+DIM V3707 AS INTEGER
+DIM V3708 AS INTEGER
+DIM V3709 AS INTEGER
+DIM V3710 AS INTEGER
+DIM V3711 AS INTEGER
+DIM V3712 AS INTEGER
+DIM V3713 AS INTEGER
+DIM V3714 AS INTEGER
+DIM V3715 AS INTEGER
+DIM V3716 AS INTEGER
+DIM V3717 AS INTEGER
+DIM V3718 AS INTEGER
+DIM V3719 AS INTEGER
+DIM V3720 AS INTEGER
+DIM V3721 AS INTEGER
+DIM V3722 AS INTEGER
+DIM V3723 AS INTEGER
+DIM V3724 AS INTEGER
+DIM V3725 AS INTEGER
+DIM V3726 AS INTEGER
+DIM V3727 AS INTEGER
+DIM V3728 AS INTEGER
+DIM V3729 AS INTEGER
+DIM V3730 AS INTEGER
+DIM V3731 AS INTEGER
+DIM V3732 AS INTEGER
+DIM V3733 AS INTEGER
+DIM V3734 AS INTEGER
+DIM V3735 AS INTEGER
+DIM V3736 AS INTEGER
+DIM V3737 AS INTEGER
+DIM V3738 AS INTEGER
+DIM V3739 AS INTEGER
+DIM V3740 AS INTEGER
+DIM V3741 AS INTEGER
+DIM V3742 AS INTEGER
+DIM V3743 AS INTEGER
+DIM V3744 AS INTEGER
+DIM V3745 AS INTEGER
+DIM V3746 AS INTEGER
+DIM V3747 AS INTEGER
+DIM V3748 AS INTEGER
+DIM V3749 AS INTEGER
+DIM V3750 AS INTEGER
+DIM V3751 AS INTEGER
+DIM V3752 AS INTEGER
+DIM V3753 AS INTEGER
+DIM V3754 AS INTEGER
+DIM V3755 AS INTEGER
+DIM V3756 AS INTEGER
+DIM V3757 AS INTEGER
+DIM V3758 AS INTEGER
+DIM V3759 AS INTEGER
+DIM V3760 AS INTEGER
+DIM V3761 AS INTEGER
+DIM V3762 AS INTEGER
+DIM V3763 AS INTEGER
+DIM V3764 AS INTEGER
+DIM V3765 AS INTEGER
+DIM V3766 AS INTEGER
+DIM V3767 AS INTEGER
+DIM V3768 AS INTEGER
+DIM V3769 AS INTEGER
+DIM V3770 AS INTEGER
+DIM V3771 AS INTEGER
+DIM V3772 AS INTEGER
+DIM V3773 AS INTEGER
+DIM V3774 AS INTEGER
+DIM V3775 AS INTEGER
+DIM V3776 AS INTEGER
+DIM V3777 AS INTEGER
+DIM V3778 AS INTEGER
+DIM V3779 AS INTEGER
+DIM V3780 AS INTEGER
+DIM V3781 AS INTEGER
+DIM V3782 AS INTEGER
+DIM V3783 AS INTEGER
+DIM V3784 AS INTEGER
+DIM V3785 AS INTEGER
+DIM V3786 AS INTEGER
+DIM V3787 AS INTEGER
+DIM V3788 AS INTEGER
+DIM V3789 AS INTEGER
+DIM V3790 AS INTEGER
+DIM V3791 AS INTEGER
+DIM V3792 AS INTEGER
+DIM V3793 AS INTEGER
+DIM V3794 AS INTEGER
+DIM V3795 AS INTEGER
+DIM V3796 AS INTEGER
+DIM V3797 AS INTEGER
+DIM V3798 AS INTEGER
+DIM V3799 AS INTEGER
+DIM V3800 AS INTEGER
+DIM V3801 AS INTEGER
+DIM V3802 AS INTEGER
+DIM V3803 AS INTEGER
+DIM V3804 AS INTEGER
+DIM V3805 AS INTEGER
+DIM V3806 AS INTEGER
+DIM V3807 AS INTEGER
+DIM V3808 AS INTEGER
+DIM V3809 AS INTEGER
+DIM V3810 AS INTEGER
+DIM V3811 AS INTEGER
+DIM V3812 AS INTEGER
+DIM V3813 AS INTEGER
+DIM V3814 AS INTEGER
+DIM V3815 AS INTEGER
+DIM V3816 AS INTEGER
+DIM V3817 AS INTEGER
+DIM V3818 AS INTEGER
+DIM V3819 AS INTEGER
+DIM V3820 AS INTEGER
+DIM V3821 AS INTEGER
+DIM V3822 AS INTEGER
+DIM V3823 AS INTEGER
+DIM V3824 AS INTEGER
+DIM V3825 AS INTEGER
+DIM V3826 AS INTEGER
+DIM V3827 AS INTEGER
+DIM V3828 AS INTEGER
+DIM V3829 AS INTEGER
+DIM V3830 AS INTEGER
+DIM V3831 AS INTEGER
+DIM V3832 AS INTEGER
+DIM V3833 AS INTEGER
+DIM V3834 AS INTEGER
+DIM V3835 AS INTEGER
+DIM V3836 AS INTEGER
+DIM V3837 AS INTEGER
+DIM V3838 AS INTEGER
+DIM V3839 AS INTEGER
+DIM V3840 AS INTEGER
+DIM V3841 AS INTEGER
+DIM V3842 AS INTEGER
+DIM V3843 AS INTEGER
+DIM V3844 AS INTEGER
+DIM V3845 AS INTEGER
+DIM V3846 AS INTEGER
+DIM V3847 AS INTEGER
+DIM V3848 AS INTEGER
+DIM V3849 AS INTEGER
+DIM V3850 AS INTEGER
+DIM V3851 AS INTEGER
+DIM V3852 AS INTEGER
+DIM V3853 AS INTEGER
+DIM V3854 AS INTEGER
+DIM V3855 AS INTEGER
+DIM V3856 AS INTEGER
+DIM V3857 AS INTEGER
+DIM V3858 AS INTEGER
+DIM V3859 AS INTEGER
+DIM V3860 AS INTEGER
+DIM V3861 AS INTEGER
+DIM V3862 AS INTEGER
+DIM V3863 AS INTEGER
+DIM V3864 AS INTEGER
+DIM V3865 AS INTEGER
+DIM V3866 AS INTEGER
+DIM V3867 AS INTEGER
+DIM V3868 AS INTEGER
+DIM V3869 AS INTEGER
+DIM V3870 AS INTEGER
+DIM V3871 AS INTEGER
+DIM V3872 AS INTEGER
+DIM V3873 AS INTEGER
+DIM V3874 AS INTEGER
+DIM V3875 AS INTEGER
+DIM V3876 AS INTEGER
+DIM V3877 AS INTEGER
+DIM V3878 AS INTEGER
+DIM V3879 AS INTEGER
+DIM V3880 AS INTEGER
+DIM V3881 AS INTEGER
+DIM V3882 AS INTEGER
+DIM V3883 AS INTEGER
+DIM V3884 AS INTEGER
+DIM V3885 AS INTEGER
+DIM V3886 AS INTEGER
+DIM V3887 AS INTEGER
+DIM V3888 AS INTEGER
+DIM V3889 AS INTEGER
+DIM V3890 AS INTEGER
+DIM V3891 AS INTEGER
+DIM V3892 AS INTEGER
+DIM V3893 AS INTEGER
+DIM V3894 AS INTEGER
+DIM V3895 AS INTEGER
+DIM V3896 AS INTEGER
+DIM V3897 AS INTEGER
+DIM V3898 AS INTEGER
+DIM V3899 AS INTEGER
+DIM V3900 AS INTEGER
+DIM V3901 AS INTEGER
+DIM V3902 AS INTEGER
+DIM V3903 AS INTEGER
+DIM V3904 AS INTEGER
+DIM V3905 AS INTEGER
+DIM V3906 AS INTEGER
+DIM V3907 AS INTEGER
+DIM V3908 AS INTEGER
+DIM V3909 AS INTEGER
+DIM V3910 AS INTEGER
+DIM V3911 AS INTEGER
+DIM V3912 AS INTEGER
+DIM V3913 AS INTEGER
+DIM V3914 AS INTEGER
+DIM V3915 AS INTEGER
+DIM V3916 AS INTEGER
+DIM V3917 AS INTEGER
+DIM V3918 AS INTEGER
+DIM V3919 AS INTEGER
+DIM V3920 AS INTEGER
+DIM V3921 AS INTEGER
+DIM V3922 AS INTEGER
+DIM V3923 AS INTEGER
+DIM V3924 AS INTEGER
+DIM V3925 AS INTEGER
+DIM V3926 AS INTEGER
+DIM V3927 AS INTEGER
+DIM V3928 AS INTEGER
+DIM V3929 AS INTEGER
+DIM V3930 AS INTEGER
+DIM V3931 AS INTEGER
+DIM V3932 AS INTEGER
+DIM V3933 AS INTEGER
+DIM V3934 AS INTEGER
+DIM V3935 AS INTEGER
+DIM V3936 AS INTEGER
+DIM V3937 AS INTEGER
+DIM V3938 AS INTEGER
+DIM V3939 AS INTEGER
+DIM V3940 AS INTEGER
+DIM V3941 AS INTEGER
+DIM V3942 AS INTEGER
+DIM V3943 AS INTEGER
+DIM V3944 AS INTEGER
+DIM V3945 AS INTEGER
+DIM V3946 AS INTEGER
+DIM V3947 AS INTEGER
+DIM V3948 AS INTEGER
+DIM V3949 AS INTEGER
+DIM V3950 AS INTEGER
+DIM V3951 AS INTEGER
+DIM V3952 AS INTEGER
+DIM V3953 AS INTEGER
+DIM V3954 AS INTEGER
+DIM V3955 AS INTEGER
+DIM V3956 AS INTEGER
+DIM V3957 AS INTEGER
+DIM V3958 AS INTEGER
+DIM V3959 AS INTEGER
+DIM V3960 AS INTEGER
+DIM V3961 AS INTEGER
+DIM V3962 AS INTEGER
+DIM V3963 AS INTEGER
+DIM V3964 AS INTEGER
+DIM V3965 AS INTEGER
+DIM V3966 AS INTEGER
+DIM V3967 AS INTEGER
+DIM V3968 AS INTEGER
+DIM V3969 AS INTEGER
+DIM V3970 AS INTEGER
+DIM V3971 AS INTEGER
+DIM V3972 AS INTEGER
+DIM V3973 AS INTEGER
+DIM V3974 AS INTEGER
+DIM V3975 AS INTEGER
+DIM V3976 AS INTEGER
+DIM V3977 AS INTEGER
+DIM V3978 AS INTEGER
+DIM V3979 AS INTEGER
+DIM V3980 AS INTEGER
+DIM V3981 AS INTEGER
+DIM V3982 AS INTEGER
+DIM V3983 AS INTEGER
+DIM V3984 AS INTEGER
+DIM V3985 AS INTEGER
+DIM V3986 AS INTEGER
+DIM V3987 AS INTEGER
+DIM V3988 AS INTEGER
+DIM V3989 AS INTEGER
+DIM V3990 AS INTEGER
+DIM V3991 AS INTEGER
+DIM V3992 AS INTEGER
+DIM V3993 AS INTEGER
+DIM V3994 AS INTEGER
+DIM V3995 AS INTEGER
+DIM V3996 AS INTEGER
+DIM V3997 AS INTEGER
+DIM V3998 AS INTEGER
+DIM V3999 AS INTEGER
+DIM V4000 AS INTEGER
+DIM V4001 AS INTEGER
+DIM V4002 AS INTEGER
+DIM V4003 AS INTEGER
+DIM V4004 AS INTEGER
+DIM V4005 AS INTEGER
+DIM V4006 AS INTEGER
+DIM V4007 AS INTEGER
+DIM V4008 AS INTEGER
+DIM V4009 AS INTEGER
+DIM V4010 AS INTEGER
+DIM V4011 AS INTEGER
+DIM V4012 AS INTEGER
+DIM V4013 AS INTEGER
+DIM V4014 AS INTEGER
+DIM V4015 AS INTEGER
+DIM V4016 AS INTEGER
+DIM V4017 AS INTEGER
+DIM V4018 AS INTEGER
+DIM V4019 AS INTEGER
+DIM V4020 AS INTEGER
+DIM V4021 AS INTEGER
+DIM V4022 AS INTEGER
+DIM V4023 AS INTEGER
+DIM V4024 AS INTEGER
+DIM V4025 AS INTEGER
+DIM V4026 AS INTEGER
+DIM V4027 AS INTEGER
+DIM V4028 AS INTEGER
+DIM V4029 AS INTEGER
+DIM V4030 AS INTEGER
+DIM V4031 AS INTEGER
+DIM V4032 AS INTEGER
+DIM V4033 AS INTEGER
+DIM V4034 AS INTEGER
+DIM V4035 AS INTEGER
+DIM V4036 AS INTEGER
+DIM V4037 AS INTEGER
+DIM V4038 AS INTEGER
+DIM V4039 AS INTEGER
+DIM V4040 AS INTEGER
+DIM V4041 AS INTEGER
+DIM V4042 AS INTEGER
+DIM V4043 AS INTEGER
+DIM V4044 AS INTEGER
+DIM V4045 AS INTEGER
+DIM V4046 AS INTEGER
+DIM V4047 AS INTEGER
+DIM V4048 AS INTEGER
+DIM V4049 AS INTEGER
+DIM V4050 AS INTEGER
+DIM V4051 AS INTEGER
+DIM V4052 AS INTEGER
+DIM V4053 AS INTEGER
+DIM V4054 AS INTEGER
+DIM V4055 AS INTEGER
+DIM V4056 AS INTEGER
+DIM V4057 AS INTEGER
+DIM V4058 AS INTEGER
+DIM V4059 AS INTEGER
+DIM V4060 AS INTEGER
+DIM V4061 AS INTEGER
+DIM V4062 AS INTEGER
+DIM V4063 AS INTEGER
+DIM V4064 AS INTEGER
+DIM V4065 AS INTEGER
+DIM V4066 AS INTEGER
+DIM V4067 AS INTEGER
+DIM V4068 AS INTEGER
+DIM V4069 AS INTEGER
+DIM V4070 AS INTEGER
+DIM V4071 AS INTEGER
+DIM V4072 AS INTEGER
+DIM V4073 AS INTEGER
+DIM V4074 AS INTEGER
+DIM V4075 AS INTEGER
+DIM V4076 AS INTEGER
+DIM V4077 AS INTEGER
+DIM V4078 AS INTEGER
+DIM V4079 AS INTEGER
+DIM V4080 AS INTEGER
+DIM V4081 AS INTEGER
+DIM V4082 AS INTEGER
+DIM V4083 AS INTEGER
+DIM V4084 AS INTEGER
+DIM V4085 AS INTEGER
+DIM V4086 AS INTEGER
+DIM V4087 AS INTEGER
+DIM V4088 AS INTEGER
+DIM V4089 AS INTEGER
+DIM V4090 AS INTEGER
+DIM V4091 AS INTEGER
+DIM V4092 AS INTEGER
+DIM V4093 AS INTEGER
+DIM V4094 AS INTEGER
+DIM V4095 AS INTEGER
+DIM V4096 AS INTEGER
+DIM V4097 AS INTEGER
+DIM V4098 AS INTEGER
+DIM V4099 AS INTEGER
+DIM V4100 AS INTEGER
+DIM V4101 AS INTEGER
+DIM V4102 AS INTEGER
+DIM V4103 AS INTEGER
+DIM V4104 AS INTEGER
+DIM V4105 AS INTEGER
+DIM V4106 AS INTEGER
+DIM V4107 AS INTEGER
+DIM V4108 AS INTEGER
+DIM V4109 AS INTEGER
+DIM V4110 AS INTEGER
+DIM V4111 AS INTEGER
+DIM V4112 AS INTEGER
+DIM V4113 AS INTEGER
+DIM V4114 AS INTEGER
+DIM V4115 AS INTEGER
+DIM V4116 AS INTEGER
+DIM V4117 AS INTEGER
+DIM V4118 AS INTEGER
+DIM V4119 AS INTEGER
+DIM V4120 AS INTEGER
+DIM V4121 AS INTEGER
+DIM V4122 AS INTEGER
+DIM V4123 AS INTEGER
+DIM V4124 AS INTEGER
+DIM V4125 AS INTEGER
+DIM V4126 AS INTEGER
+DIM V4127 AS INTEGER
+DIM V4128 AS INTEGER
+DIM V4129 AS INTEGER
+DIM V4130 AS INTEGER
+DIM V4131 AS INTEGER
+DIM V4132 AS INTEGER
+DIM V4133 AS INTEGER
+DIM V4134 AS INTEGER
+DIM V4135 AS INTEGER
+DIM V4136 AS INTEGER
+DIM V4137 AS INTEGER
+DIM V4138 AS INTEGER
+DIM V4139 AS INTEGER
+DIM V4140 AS INTEGER
+DIM V4141 AS INTEGER
+DIM V4142 AS INTEGER
+DIM V4143 AS INTEGER
+DIM V4144 AS INTEGER
+DIM V4145 AS INTEGER
+DIM V4146 AS INTEGER
+DIM V4147 AS INTEGER
+DIM V4148 AS INTEGER
+DIM V4149 AS INTEGER
+DIM V4150 AS INTEGER
+DIM V4151 AS INTEGER
+DIM V4152 AS INTEGER
+DIM V4153 AS INTEGER
+DIM V4154 AS INTEGER
+DIM V4155 AS INTEGER
+DIM V4156 AS INTEGER
+DIM V4157 AS INTEGER
+DIM V4158 AS INTEGER
+DIM V4159 AS INTEGER
+DIM V4160 AS INTEGER
+DIM V4161 AS INTEGER
+DIM V4162 AS INTEGER
+DIM V4163 AS INTEGER
+DIM V4164 AS INTEGER
+DIM V4165 AS INTEGER
+DIM V4166 AS INTEGER
+DIM V4167 AS INTEGER
+DIM V4168 AS INTEGER
+DIM V4169 AS INTEGER
+DIM V4170 AS INTEGER
+DIM V4171 AS INTEGER
+DIM V4172 AS INTEGER
+DIM V4173 AS INTEGER
+DIM V4174 AS INTEGER
+DIM V4175 AS INTEGER
+DIM V4176 AS INTEGER
+DIM V4177 AS INTEGER
+DIM V4178 AS INTEGER
+DIM V4179 AS INTEGER
+DIM V4180 AS INTEGER
+DIM V4181 AS INTEGER
+DIM V4182 AS INTEGER
+DIM V4183 AS INTEGER
+DIM V4184 AS INTEGER
+DIM V4185 AS INTEGER
+DIM V4186 AS INTEGER
+DIM V4187 AS INTEGER
+DIM V4188 AS INTEGER
+DIM V4189 AS INTEGER
+DIM V4190 AS INTEGER
+DIM V4191 AS INTEGER
+DIM V4192 AS INTEGER
+DIM V4193 AS INTEGER
+DIM V4194 AS INTEGER
+DIM V4195 AS INTEGER
+DIM V4196 AS INTEGER
+DIM V4197 AS INTEGER
+DIM V4198 AS INTEGER
+DIM V4199 AS INTEGER
+DIM V4200 AS INTEGER
+DIM V4201 AS INTEGER
+DIM V4202 AS INTEGER
+DIM V4203 AS INTEGER
+DIM V4204 AS INTEGER
+DIM V4205 AS INTEGER
+DIM V4206 AS INTEGER
+DIM V4207 AS INTEGER
+DIM V4208 AS INTEGER
+DIM V4209 AS INTEGER
+DIM V4210 AS INTEGER
+DIM V4211 AS INTEGER
+DIM V4212 AS INTEGER
+DIM V4213 AS INTEGER
+DIM V4214 AS INTEGER
+DIM V4215 AS INTEGER
+DIM V4216 AS INTEGER
+DIM V4217 AS INTEGER
+DIM V4218 AS INTEGER
+DIM V4219 AS INTEGER
+DIM V4220 AS INTEGER
+DIM V4221 AS INTEGER
+DIM V4222 AS INTEGER
+DIM V4223 AS INTEGER
+DIM V4224 AS INTEGER
+DIM V4225 AS INTEGER
+DIM V4226 AS INTEGER
+DIM V4227 AS INTEGER
+DIM V4228 AS INTEGER
+DIM V4229 AS INTEGER
+DIM V4230 AS INTEGER
+DIM V4231 AS INTEGER
+DIM V4232 AS INTEGER
+DIM V4233 AS INTEGER
+DIM V4234 AS INTEGER
+DIM V4235 AS INTEGER
+DIM V4236 AS INTEGER
+DIM V4237 AS INTEGER
+DIM V4238 AS INTEGER
+DIM V4239 AS INTEGER
+DIM V4240 AS INTEGER
+DIM V4241 AS INTEGER
+DIM V4242 AS INTEGER
+DIM V4243 AS INTEGER
+DIM V4244 AS INTEGER
+DIM V4245 AS INTEGER
+DIM V4246 AS INTEGER
+DIM V4247 AS INTEGER
+DIM V4248 AS INTEGER
+DIM V4249 AS INTEGER
+DIM V4250 AS INTEGER
+DIM V4251 AS INTEGER
+DIM V4252 AS INTEGER
+DIM V4253 AS INTEGER
+DIM V4254 AS INTEGER
+DIM V4255 AS INTEGER
+DIM V4256 AS INTEGER
+DIM V4257 AS INTEGER
+DIM V4258 AS INTEGER
+DIM V4259 AS INTEGER
+DIM V4260 AS INTEGER
+DIM V4261 AS INTEGER
+DIM V4262 AS INTEGER
+DIM V4263 AS INTEGER
+DIM V4264 AS INTEGER
+DIM V4265 AS INTEGER
+DIM V4266 AS INTEGER
+DIM V4267 AS INTEGER
+DIM V4268 AS INTEGER
+DIM V4269 AS INTEGER
+DIM V4270 AS INTEGER
+DIM V4271 AS INTEGER
+DIM V4272 AS INTEGER
+DIM V4273 AS INTEGER
+DIM V4274 AS INTEGER
+DIM V4275 AS INTEGER
+DIM V4276 AS INTEGER
+DIM V4277 AS INTEGER
+DIM V4278 AS INTEGER
+DIM V4279 AS INTEGER
+DIM V4280 AS INTEGER
+DIM V4281 AS INTEGER
+DIM V4282 AS INTEGER
+DIM V4283 AS INTEGER
+DIM V4284 AS INTEGER
+DIM V4285 AS INTEGER
+DIM V4286 AS INTEGER
+DIM V4287 AS INTEGER
+DIM V4288 AS INTEGER
+DIM V4289 AS INTEGER
+DIM V4290 AS INTEGER
+DIM V4291 AS INTEGER
+DIM V4292 AS INTEGER
+DIM V4293 AS INTEGER
+DIM V4294 AS INTEGER
+DIM V4295 AS INTEGER
+DIM V4296 AS INTEGER
+DIM V4297 AS INTEGER
+DIM V4298 AS INTEGER
+DIM V4299 AS INTEGER
+DIM V4300 AS INTEGER
+DIM V4301 AS INTEGER
+DIM V4302 AS INTEGER
+DIM V4303 AS INTEGER
+DIM V4304 AS INTEGER
+DIM V4305 AS INTEGER
+DIM V4306 AS INTEGER
+DIM V4307 AS INTEGER
+DIM V4308 AS INTEGER
+DIM V4309 AS INTEGER
+DIM V4310 AS INTEGER
+DIM V4311 AS INTEGER
+DIM V4312 AS INTEGER
+DIM V4313 AS INTEGER
+DIM V4314 AS INTEGER
+DIM V4315 AS INTEGER
+DIM V4316 AS INTEGER
+DIM V4317 AS INTEGER
+DIM V4318 AS INTEGER
+DIM V4319 AS INTEGER
+DIM V4320 AS INTEGER
+DIM V4321 AS INTEGER
+DIM V4322 AS INTEGER
+DIM V4323 AS INTEGER
+DIM V4324 AS INTEGER
+DIM V4325 AS INTEGER
+DIM V4326 AS INTEGER
+DIM V4327 AS INTEGER
+DIM V4328 AS INTEGER
+DIM V4329 AS INTEGER
+DIM V4330 AS INTEGER
+DIM V4331 AS INTEGER
+DIM V4332 AS INTEGER
+DIM V4333 AS INTEGER
+DIM V4334 AS INTEGER
+DIM V4335 AS INTEGER
+DIM V4336 AS INTEGER
+DIM V4337 AS INTEGER
+DIM V4338 AS INTEGER
+DIM V4339 AS INTEGER
+DIM V4340 AS INTEGER
+DIM V4341 AS INTEGER
+DIM V4342 AS INTEGER
+DIM V4343 AS INTEGER
+DIM V4344 AS INTEGER
+DIM V4345 AS INTEGER
+DIM V4346 AS INTEGER
+DIM V4347 AS INTEGER
+DIM V4348 AS INTEGER
+DIM V4349 AS INTEGER
+DIM V4350 AS INTEGER
+DIM V4351 AS INTEGER
+DIM V4352 AS INTEGER
+DIM V4353 AS INTEGER
+DIM V4354 AS INTEGER
+DIM V4355 AS INTEGER
+DIM V4356 AS INTEGER
+DIM V4357 AS INTEGER
+DIM V4358 AS INTEGER
+DIM V4359 AS INTEGER
+DIM V4360 AS INTEGER
+DIM V4361 AS INTEGER
+DIM V4362 AS INTEGER
+DIM V4363 AS INTEGER
+DIM V4364 AS INTEGER
+DIM V4365 AS INTEGER
+DIM V4366 AS INTEGER
+DIM V4367 AS INTEGER
+DIM V4368 AS INTEGER
+DIM V4369 AS INTEGER
+DIM V4370 AS INTEGER
+DIM V4371 AS INTEGER
+DIM V4372 AS INTEGER
+DIM V4373 AS INTEGER
+DIM V4374 AS INTEGER
+DIM V4375 AS INTEGER
+DIM V4376 AS INTEGER
+DIM V4377 AS INTEGER
+DIM V4378 AS INTEGER
+DIM V4379 AS INTEGER
+DIM V4380 AS INTEGER
+DIM V4381 AS INTEGER
+DIM V4382 AS INTEGER
+DIM V4383 AS INTEGER
+DIM V4384 AS INTEGER
+DIM V4385 AS INTEGER
+DIM V4386 AS INTEGER
+DIM V4387 AS INTEGER
+DIM V4388 AS INTEGER
+DIM V4389 AS INTEGER
+DIM V4390 AS INTEGER
+DIM V4391 AS INTEGER
+DIM V4392 AS INTEGER
+DIM V4393 AS INTEGER
+DIM V4394 AS INTEGER
+DIM V4395 AS INTEGER
+DIM V4396 AS INTEGER
+DIM V4397 AS INTEGER
+DIM V4398 AS INTEGER
+DIM V4399 AS INTEGER
+DIM V4400 AS INTEGER
+DIM V4401 AS INTEGER
+DIM V4402 AS INTEGER
+DIM V4403 AS INTEGER
+DIM V4404 AS INTEGER
+DIM V4405 AS INTEGER
+DIM V4406 AS INTEGER
+DIM V4407 AS INTEGER
+DIM V4408 AS INTEGER
+DIM V4409 AS INTEGER
+DIM V4410 AS INTEGER
+DIM V4411 AS INTEGER
+DIM V4412 AS INTEGER
+DIM V4413 AS INTEGER
+DIM V4414 AS INTEGER
+DIM V4415 AS INTEGER
+DIM V4416 AS INTEGER
+DIM V4417 AS INTEGER
+DIM V4418 AS INTEGER
+DIM V4419 AS INTEGER
+DIM V4420 AS INTEGER
+DIM V4421 AS INTEGER
+DIM V4422 AS INTEGER
+DIM V4423 AS INTEGER
+DIM V4424 AS INTEGER
+DIM V4425 AS INTEGER
+DIM V4426 AS INTEGER
+DIM V4427 AS INTEGER
+DIM V4428 AS INTEGER
+DIM V4429 AS INTEGER
+DIM V4430 AS INTEGER
+DIM V4431 AS INTEGER
+DIM V4432 AS INTEGER
+DIM V4433 AS INTEGER
+DIM V4434 AS INTEGER
+DIM V4435 AS INTEGER
+DIM V4436 AS INTEGER
+DIM V4437 AS INTEGER
+DIM V4438 AS INTEGER
+DIM V4439 AS INTEGER
+DIM V4440 AS INTEGER
+DIM V4441 AS INTEGER
+DIM V4442 AS INTEGER
+DIM V4443 AS INTEGER
+DIM V4444 AS INTEGER
+DIM V4445 AS INTEGER
+DIM V4446 AS INTEGER
+DIM V4447 AS INTEGER
+DIM V4448 AS INTEGER
+DIM V4449 AS INTEGER
+DIM V4450 AS INTEGER
+DIM V4451 AS INTEGER
+DIM V4452 AS INTEGER
+DIM V4453 AS INTEGER
+DIM V4454 AS INTEGER
+DIM V4455 AS INTEGER
+DIM V4456 AS INTEGER
+DIM V4457 AS INTEGER
+DIM V4458 AS INTEGER
+DIM V4459 AS INTEGER
+DIM V4460 AS INTEGER
+DIM V4461 AS INTEGER
+DIM V4462 AS INTEGER
+DIM V4463 AS INTEGER
+DIM V4464 AS INTEGER
+DIM V4465 AS INTEGER
+DIM V4466 AS INTEGER
+DIM V4467 AS INTEGER
+DIM V4468 AS INTEGER
+DIM V4469 AS INTEGER
+DIM V4470 AS INTEGER
+DIM V4471 AS INTEGER
+DIM V4472 AS INTEGER
+DIM V4473 AS INTEGER
+DIM V4474 AS INTEGER
+DIM V4475 AS INTEGER
+DIM V4476 AS INTEGER
+DIM V4477 AS INTEGER
+DIM V4478 AS INTEGER
+DIM V4479 AS INTEGER
+DIM V4480 AS INTEGER
+DIM V4481 AS INTEGER
+DIM V4482 AS INTEGER
+DIM V4483 AS INTEGER
+DIM V4484 AS INTEGER
+DIM V4485 AS INTEGER
+DIM V4486 AS INTEGER
+DIM V4487 AS INTEGER
+DIM V4488 AS INTEGER
+DIM V4489 AS INTEGER
+DIM V4490 AS INTEGER
+DIM V4491 AS INTEGER
+DIM V4492 AS INTEGER
+DIM V4493 AS INTEGER
+DIM V4494 AS INTEGER
+DIM V4495 AS INTEGER
+DIM V4496 AS INTEGER
+DIM V4497 AS INTEGER
+DIM V4498 AS INTEGER
+DIM V4499 AS INTEGER
+DIM V4500 AS INTEGER
+DIM I AS INTEGER
+
+V1 = 1
+V2250 = 20
+V4500 = 300
+FOR I = 1 TO 10
+    V4499 = V4499 + I * (V1 + V2250) - (V4500 - I) * 2
+NEXT I
+PRINT V1 + V2250 + V4500
+PRINT V4499
+PRINT (V1 + V2) * (V2250 + V3) + (V4500 - V4) * (V4499 + V5)